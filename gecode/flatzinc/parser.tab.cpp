@@ -287,6 +287,33 @@ int getBaseSetVar(ParserState* pp, int i) {
   return base;
 }
 
+/// Test whether constraint \a cid with arguments \a args states \a x0 = \a x1
+bool isIntVarEq(const std::string& cid, AST::Array* args, int& x0, int& x1) {
+  if (cid=="int_eq") {
+    if (args->a[0]->isIntVar() && args->a[1]->isIntVar()) {
+      x0 = args->a[0]->getIntVar(); x1 = args->a[1]->getIntVar();
+      return true;
+    }
+  } else if (cid=="int_lin_eq") {
+    // Linear equation c*x0 - c*x1 = 0
+    int c;
+    if (!args->a[2]->isInt(c) || (c != 0) ||
+        !args->a[0]->isArray() || !args->a[1]->isArray())
+      return false;
+    AST::Array* a = args->a[0]->getArray();
+    AST::Array* x = args->a[1]->getArray();
+    int a0, a1;
+    if ((a->a.size() == 2) && (x->a.size() == 2) &&
+        a->a[0]->isInt(a0) && a->a[1]->isInt(a1) &&
+        (a0 != 0) && (a0 == -a1) &&
+        x->a[0]->isIntVar() && x->a[1]->isIntVar()) {
+      x0 = x->a[0]->getIntVar(); x1 = x->a[1]->getIntVar();
+      return true;
+    }
+  }
+  return false;
+}
+
 /*
  * Initialize the root gecode space
  *
@@ -495,7 +522,7 @@ namespace Gecode { namespace FlatZinc {
 }}
 
 
-#line 499 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:339  */
+#line 526 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:339  */
 
 # ifndef YY_NULLPTR
 #  if defined __cplusplus && 201103L <= __cplusplus
@@ -583,7 +610,7 @@ extern int yydebug;
 
 union YYSTYPE
 {
-#line 470 "gecode/flatzinc/parser.yxx" /* yacc.c:355  */
+#line 497 "gecode/flatzinc/parser.yxx" /* yacc.c:355  */
  int iValue; char* sValue; bool bValue; double dValue;
          std::vector<int>* setValue;
          Gecode::FlatZinc::AST::SetLit* setLit;
@@ -599,7 +626,7 @@ union YYSTYPE
          Gecode::FlatZinc::AST::Array* argVec;
        
 
-#line 603 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:355  */
+#line 630 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:355  */
 };
 
 typedef union YYSTYPE YYSTYPE;
@@ -615,7 +642,7 @@ int yyparse (void *parm);
 
 /* Copy the second part of user declarations.  */
 
-#line 619 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:358  */
+#line 646 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:358  */
 
 #ifdef short
 # undef short
@@ -1957,31 +1984,31 @@ yyreduce:
   switch (yyn)
     {
         case 15:
-#line 604 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 631 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { free((yyvsp[-3].sValue)); }
-#line 1963 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 1990 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 20:
-#line 616 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 643 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { free((yyvsp[0].sValue)); }
-#line 1969 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 1996 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 25:
-#line 626 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 653 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 1975 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2002 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 26:
-#line 628 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 655 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { if ((yyvsp[0].oSet)()) delete (yyvsp[0].oSet).some(); }
-#line 1981 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2008 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 35:
-#line 648 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 675 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2013,11 +2040,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2017 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2044 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 36:
-#line 680 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 707 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2049,11 +2076,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2053 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2080 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 37:
-#line 712 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 739 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2092,11 +2119,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2096 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2123 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 38:
-#line 751 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 778 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasAtom("output_var");
@@ -2129,11 +2156,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2133 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2160 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 39:
-#line 784 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 811 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isInt(), "Invalid int initializer");
@@ -2142,11 +2169,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2146 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2173 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 40:
-#line 793 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 820 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isFloat(), "Invalid float initializer");
@@ -2156,11 +2183,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2160 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2187 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 41:
-#line 803 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 830 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isBool(), "Invalid bool initializer");
@@ -2169,11 +2196,11 @@ yyreduce:
           "Duplicate symbol");
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2173 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2200 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 42:
-#line 812 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 839 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[0].arg)->isSet(), "Invalid set initializer");
@@ -2185,11 +2212,11 @@ yyreduce:
         delete set;
         delete (yyvsp[-2].argVec); free((yyvsp[-3].sValue));
       }
-#line 2189 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2216 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 43:
-#line 825 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 852 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2258,11 +2285,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2262 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2289 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 44:
-#line 895 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 922 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2327,11 +2354,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2331 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2358 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 45:
-#line 962 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 989 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-10].iValue)==1, "Arrays must start at 1");
@@ -2400,11 +2427,11 @@ yyreduce:
         if ((yyvsp[-4].oPFloat)()) delete (yyvsp[-4].oPFloat).some();
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2404 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2431 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 46:
-#line 1032 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1059 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         bool print = (yyvsp[-1].argVec) != NULL && (yyvsp[-1].argVec)->hasCall("output_array");
@@ -2471,11 +2498,11 @@ yyreduce:
         }
         delete (yyvsp[-1].argVec); free((yyvsp[-2].sValue));
       }
-#line 2475 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2502 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 47:
-#line 1100 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1127 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2495,11 +2522,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2499 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2526 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 48:
-#line 1121 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1148 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2518,11 +2545,11 @@ yyreduce:
         free((yyvsp[-5].sValue));
         delete (yyvsp[-4].argVec);
       }
-#line 2522 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2549 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 49:
-#line 1141 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1168 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-12].iValue)==1, "Arrays must start at 1");
@@ -2541,11 +2568,11 @@ yyreduce:
         delete (yyvsp[-1].floatSetValue);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2545 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2572 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 50:
-#line 1161 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1188 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         yyassert(pp, (yyvsp[-14].iValue)==1, "Arrays must start at 1");
@@ -2565,19 +2592,19 @@ yyreduce:
         delete (yyvsp[-1].setValueList);
         delete (yyvsp[-4].argVec); free((yyvsp[-5].sValue));
       }
-#line 2569 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2596 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 51:
-#line 1183 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1210 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.varSpec) = new IntVarSpec((yyvsp[0].iValue),false,false);
       }
-#line 2577 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2604 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 52:
-#line 1187 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1214 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2592,11 +2619,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2596 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2623 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 53:
-#line 1202 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1229 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         vector<int> v;
         SymbolEntry e;
@@ -2617,47 +2644,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2621 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2648 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 54:
-#line 1225 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1252 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2627 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2654 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 55:
-#line 1227 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1254 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2633 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2660 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 56:
-#line 1231 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1258 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2639 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2666 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 57:
-#line 1233 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1260 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2645 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2672 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 60:
-#line 1238 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1265 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2651 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2678 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 61:
-#line 1242 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1269 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new FloatVarSpec((yyvsp[0].dValue),false,false); }
-#line 2657 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2684 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 62:
-#line 1244 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1271 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2672,11 +2699,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2676 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2703 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 63:
-#line 1259 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1286 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2696,47 +2723,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2700 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2727 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 64:
-#line 1281 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1308 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2706 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2733 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 65:
-#line 1283 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1310 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2712 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2739 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 66:
-#line 1287 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1314 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2718 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2745 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 67:
-#line 1289 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1316 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2724 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2751 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 68:
-#line 1293 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1320 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2730 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2757 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 69:
-#line 1297 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1324 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new BoolVarSpec((yyvsp[0].iValue),false,false); }
-#line 2736 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2763 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 70:
-#line 1299 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1326 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2751,11 +2778,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2755 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2782 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 71:
-#line 1314 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1341 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2775,47 +2802,47 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2779 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2806 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 72:
-#line 1336 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1363 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2785 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2812 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 73:
-#line 1338 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1365 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2791 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2818 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 74:
-#line 1342 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1369 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2797 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2824 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 75:
-#line 1344 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1371 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2803 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2830 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 76:
-#line 1346 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1373 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2809 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2836 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 77:
-#line 1350 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1377 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpec) = new SetVarSpec((yyvsp[0].setLit),false,false); }
-#line 2815 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2842 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 78:
-#line 1352 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1379 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -2830,11 +2857,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 2834 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2861 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 79:
-#line 1367 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1394 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState* pp = static_cast<ParserState*>(parm);
@@ -2854,96 +2881,97 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 2858 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2885 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 80:
-#line 1389 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1416 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(0); }
-#line 2864 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2891 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 81:
-#line 1391 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1418 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2870 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2897 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 82:
-#line 1395 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1422 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = new vector<VarSpec*>(1); (*(yyval.varSpecVec))[0] = (yyvsp[0].varSpec); }
-#line 2876 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2903 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 83:
-#line 1397 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1424 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-2].varSpecVec); (yyval.varSpecVec)->push_back((yyvsp[0].varSpec)); }
-#line 2882 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2909 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 84:
-#line 1400 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1427 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.varSpecVec) = (yyvsp[-1].varSpecVec); }
-#line 2888 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2915 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 85:
-#line 1404 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1431 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2894 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2921 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 86:
-#line 1406 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1433 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2900 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2927 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 87:
-#line 1410 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1437 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2906 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2933 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 88:
-#line 1412 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1439 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2912 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2939 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 89:
-#line 1416 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1443 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2918 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2945 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 90:
-#line 1418 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1445 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2924 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2951 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 91:
-#line 1422 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1449 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::none(); }
-#line 2930 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2957 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 92:
-#line 1424 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1451 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oVarSpecVec) = Option<vector<VarSpec*>* >::some((yyvsp[0].varSpecVec)); }
-#line 2936 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 2963 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 93:
-#line 1428 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1455 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         if (!pp->hadError) {
           std::string cid((yyvsp[-4].sValue));
-          if (cid=="int_eq" && (yyvsp[-2].argVec)->a[0]->isIntVar() && (yyvsp[-2].argVec)->a[1]->isIntVar()) {
-            int base0 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[0]->getIntVar());
-            int base1 = getBaseIntVar(pp,(yyvsp[-2].argVec)->a[1]->getIntVar());
+          int x0, x1;
+          if (isIntVarEq(cid,(yyvsp[-2].argVec),x0,x1)) {
+            int base0 = getBaseIntVar(pp,x0);
+            int base1 = getBaseIntVar(pp,x1);
             if (base0 > base1) {
               std::swap(base0, base1);
             }
@@ -3046,11 +3074,11 @@ yyreduce:
         }
         free((yyvsp[-4].sValue));
       }
-#line 3050 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3078 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 94:
-#line 1539 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1567 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         initfg(pp);
@@ -3064,11 +3092,11 @@ yyreduce:
           delete (yyvsp[-1].argVec);
         }
       }
-#line 3068 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3096 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 95:
-#line 1553 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1581 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         initfg(pp);
@@ -3087,37 +3115,37 @@ yyreduce:
           delete (yyvsp[-2].argVec);
         }
       }
-#line 3091 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3119 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 96:
-#line 1578 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1606 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3097 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3125 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 97:
-#line 1580 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1608 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit(*(yyvsp[-1].setValue))); }
-#line 3103 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3131 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 98:
-#line 1582 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1610 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.oSet) = Option<AST::SetLit* >::some(new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)));
       }
-#line 3111 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3139 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 99:
-#line 1588 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1616 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oSet) = Option<AST::SetLit* >::none(); }
-#line 3117 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3145 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 100:
-#line 1590 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1618 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { bool haveTrue = false;
         bool haveFalse = false;
         for (int i=(yyvsp[-2].setValue)->size(); i--;) {
@@ -3128,192 +3156,192 @@ yyreduce:
         (yyval.oSet) = Option<AST::SetLit* >::some(
           new AST::SetLit(!haveFalse,haveTrue));
       }
-#line 3132 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3160 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 101:
-#line 1603 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1631 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oPFloat) = Option<std::pair<double,double>* >::none(); }
-#line 3138 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3166 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 102:
-#line 1605 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1633 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { std::pair<double,double>* dom = new std::pair<double,double>((yyvsp[-2].dValue),(yyvsp[0].dValue));
         (yyval.oPFloat) = Option<std::pair<double,double>* >::some(dom); }
-#line 3145 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3173 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 103:
-#line 1614 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1642 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setLit) = new AST::SetLit(*(yyvsp[-1].setValue)); }
-#line 3151 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3179 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 104:
-#line 1616 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1644 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setLit) = new AST::SetLit((yyvsp[-2].iValue), (yyvsp[0].iValue)); }
-#line 3157 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3185 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 105:
-#line 1622 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1650 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(0); }
-#line 3163 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3191 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 106:
-#line 1624 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1652 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3169 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3197 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 107:
-#line 1628 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1656 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3175 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3203 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 108:
-#line 1630 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1658 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3181 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3209 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 109:
-#line 1634 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1662 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(0); }
-#line 3187 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3215 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 110:
-#line 1636 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1664 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-1].setValue); }
-#line 3193 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3221 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 111:
-#line 1640 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1668 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = new vector<int>(1); (*(yyval.setValue))[0] = (yyvsp[0].iValue); }
-#line 3199 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3227 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 112:
-#line 1642 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1670 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValue) = (yyvsp[-2].setValue); (yyval.setValue)->push_back((yyvsp[0].iValue)); }
-#line 3205 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3233 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 113:
-#line 1646 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1674 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = new vector<double>(0); }
-#line 3211 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3239 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 114:
-#line 1648 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1676 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = (yyvsp[-1].floatSetValue); }
-#line 3217 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3245 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 115:
-#line 1652 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1680 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = new vector<double>(1); (*(yyval.floatSetValue))[0] = (yyvsp[0].dValue); }
-#line 3223 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3251 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 116:
-#line 1654 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1682 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.floatSetValue) = (yyvsp[-2].floatSetValue); (yyval.floatSetValue)->push_back((yyvsp[0].dValue)); }
-#line 3229 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3257 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 117:
-#line 1658 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1686 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = new vector<AST::SetLit>(0); }
-#line 3235 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3263 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 118:
-#line 1660 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1688 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = (yyvsp[-1].setValueList); }
-#line 3241 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3269 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 119:
-#line 1664 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1692 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = new vector<AST::SetLit>(1); (*(yyval.setValueList))[0] = *(yyvsp[0].setLit); delete (yyvsp[0].setLit); }
-#line 3247 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3275 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 120:
-#line 1666 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1694 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.setValueList) = (yyvsp[-2].setValueList); (yyval.setValueList)->push_back(*(yyvsp[0].setLit)); delete (yyvsp[0].setLit); }
-#line 3253 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3281 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 121:
-#line 1674 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1702 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3259 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3287 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 122:
-#line 1676 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1704 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3265 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3293 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 123:
-#line 1680 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1708 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3271 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3299 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 124:
-#line 1682 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1710 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-1].argVec); }
-#line 3277 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3305 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 125:
-#line 1686 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1714 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oArg) = Option<AST::Node*>::none(); }
-#line 3283 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3311 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 126:
-#line 1688 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1716 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.oArg) = Option<AST::Node*>::some((yyvsp[0].arg)); }
-#line 3289 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3317 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 127:
-#line 1692 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1720 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3295 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3323 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 128:
-#line 1694 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1722 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 3301 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3329 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 129:
-#line 1696 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1724 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 3307 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3335 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 130:
-#line 1698 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1726 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].setLit); }
-#line 3313 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3341 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 131:
-#line 1700 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1728 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3409,11 +3437,11 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3413 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3441 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 132:
-#line 1796 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1824 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -3425,35 +3453,35 @@ yyreduce:
         delete (yyvsp[-1].arg);
         free((yyvsp[-3].sValue));
       }
-#line 3429 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3457 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 133:
-#line 1810 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1838 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array(0); }
-#line 3435 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3463 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 134:
-#line 1812 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1840 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-1].argVec); }
-#line 3441 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3469 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 135:
-#line 1816 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1844 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3447 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3475 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 136:
-#line 1818 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1846 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3453 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3481 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 137:
-#line 1826 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1854 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3487,33 +3515,33 @@ yyreduce:
         }
         free((yyvsp[0].sValue));
       }
-#line 3491 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3519 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 138:
-#line 1860 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1888 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3502 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3530 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 139:
-#line 1867 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1895 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState *pp = static_cast<ParserState*>(parm);
         pp->intvars.push_back(varspec("OBJ_CONST_INTRODUCED",
           new IntVarSpec(0,true,false)));
         (yyval.iValue) = pp->intvars.size()-1;
       }
-#line 3513 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3541 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 140:
-#line 1874 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1902 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         SymbolEntry e;
         ParserState *pp = static_cast<ParserState*>(parm);
@@ -3537,103 +3565,103 @@ yyreduce:
         }
         free((yyvsp[-3].sValue));
       }
-#line 3541 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3569 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 143:
-#line 1908 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1936 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = NULL; }
-#line 3547 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3575 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 144:
-#line 1910 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1938 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[0].argVec); }
-#line 3553 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3581 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 145:
-#line 1914 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1942 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = new AST::Array((yyvsp[0].arg)); }
-#line 3559 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3587 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 146:
-#line 1916 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1944 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.argVec) = (yyvsp[-2].argVec); (yyval.argVec)->append((yyvsp[0].arg)); }
-#line 3565 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3593 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 147:
-#line 1920 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1948 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.arg) = new AST::Call((yyvsp[-3].sValue), AST::extractSingleton((yyvsp[-1].arg))); free((yyvsp[-3].sValue));
       }
-#line 3573 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3601 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 148:
-#line 1924 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1952 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3579 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3607 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 149:
-#line 1928 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1956 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::Array((yyvsp[0].arg)); }
-#line 3585 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3613 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 150:
-#line 1930 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1958 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-2].arg); (yyval.arg)->append((yyvsp[0].arg)); }
-#line 3591 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3619 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 151:
-#line 1934 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1962 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].arg); }
-#line 3597 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3625 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 152:
-#line 1936 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1964 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::Array(); }
-#line 3603 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3631 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 153:
-#line 1938 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1966 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[-2].arg); }
-#line 3609 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3637 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 156:
-#line 1944 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1972 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::BoolLit((yyvsp[0].iValue)); }
-#line 3615 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3643 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 157:
-#line 1946 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1974 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::IntLit((yyvsp[0].iValue)); }
-#line 3621 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3649 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 158:
-#line 1948 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1976 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = new AST::FloatLit((yyvsp[0].dValue)); }
-#line 3627 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3655 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 159:
-#line 1950 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1978 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     { (yyval.arg) = (yyvsp[0].setLit); }
-#line 3633 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3661 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 160:
-#line 1952 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 1980 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         SymbolEntry e;
@@ -3739,11 +3767,11 @@ yyreduce:
           (yyval.arg) = getVarRefArg(pp,(yyvsp[0].sValue),true);
         free((yyvsp[0].sValue));
       }
-#line 3743 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3771 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 161:
-#line 2058 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2086 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         ParserState* pp = static_cast<ParserState*>(parm);
         int i = -1;
@@ -3754,20 +3782,20 @@ yyreduce:
           (yyval.arg) = new AST::IntLit(0); // keep things consistent
         free((yyvsp[-3].sValue));
       }
-#line 3758 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3786 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
   case 162:
-#line 2069 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
+#line 2097 "gecode/flatzinc/parser.yxx" /* yacc.c:1646  */
     {
         (yyval.arg) = new AST::String((yyvsp[0].sValue));
         free((yyvsp[0].sValue));
       }
-#line 3767 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3795 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
     break;
 
 
-#line 3771 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
+#line 3799 "gecode/flatzinc/parser.tab.cpp" /* yacc.c:1646  */
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -1208,6 +1208,24 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   rel(Home home, const IntArgs& x, IntRelType irt, const IntVarArgs& y,
       IntPropLevel ipl=IPL_DEF);
+  /** \brief Post propagator for relation between consecutive rows of \a x.
+   *
+   * The array \a x is interpreted as a matrix with rows of width \a w
+   * stored one after the other. The relation \a irt is posted between
+   * each row and the next row. For the inequality relations this
+   * corresponds to a chain of lexical orders which is propagated by a
+   * single propagator rather than by one propagator per pair of rows.
+   *
+   * Supports bounds consistency for each row (\a ipl = IPL_BND) for
+   * the inequality relations.
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a w is
+   * not positive or the size of \a x is not a multiple of \a w.
+   *
+   * \ingroup TaskModelIntRelInt
+   */
+  GECODE_INT_EXPORT void
+  rel(Home home, const IntVarArgs& x, int w, IntRelType irt,
+      IntPropLevel ipl=IPL_DEF);
 
   /**
    * \defgroup TaskModelIntRelBool Simple relation constraints over Boolean variables
@@ -1306,6 +1324,22 @@ namespace Gecode {
   GECODE_INT_EXPORT void
   rel(Home home, const IntArgs& x, IntRelType irt, const BoolVarArgs& y,
       IntPropLevel ipl=IPL_DEF);
+  /** \brief Post propagator for relation between consecutive rows of \a x.
+   *
+   * The array \a x is interpreted as a matrix with rows of width \a w
+   * stored one after the other. The relation \a irt is posted between
+   * each row and the next row. For the inequality relations this
+   * corresponds to a chain of lexical orders which is propagated by a
+   * single propagator rather than by one propagator per pair of rows.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a w is
+   * not positive or the size of \a x is not a multiple of \a w.
+   *
+   * \ingroup TaskModelIntRelBool
+   */
+  GECODE_INT_EXPORT void
+  rel(Home home, const BoolVarArgs& x, int w, IntRelType irt,
+      IntPropLevel ipl=IPL_DEF);
   /** \brief Post domain consistent propagator for relation between elements in \a x.
    *
    * States that the elements of \a x are in the following relation:
@@ -2882,6 +2916,25 @@ namespace Gecode {
   linear(Home home, const IntArgs& a, const IntVarArgs& x,
          IntRelType irt, IntVar y, Reify r,
          IntPropLevel ipl=IPL_DEF);
+  /** \brief Post propagator for difference constraints
+   *
+   * Posts \f$x_{s_i}+c_i\leq x_{t_i}\f$ for all \f$0\leq i<|c|\f$
+   * as a single propagator. Bounds are propagated along chains of
+   * difference constraints in a single run instead of one constraint
+   * at a time. Fails if the constraints contain a cycle of positive
+   * length.
+   *
+   * Throws an exception of type Int::ArgumentSizeMismatch, if \a s,
+   * \a c, and \a t are of different size.
+   *
+   * Throws an exception of type Int::OutOfLimits, if an element of
+   * \a s or \a t is not an index of \a x.
+   * \ingroup TaskModelIntLI
+   */
+  GECODE_INT_EXPORT void
+  difference(Home home, const IntVarArgs& x,
+             const IntArgs& s, const IntArgs& c, const IntArgs& t,
+             IntPropLevel ipl=IPL_DEF);
 
 
   /**
@@ -3054,6 +3107,46 @@ namespace Gecode {
              IntPropLevel ipl=IPL_DEF);
 
 
+  /**
+   * \defgroup TaskModelIntKnapsack Knapsack constraints
+   * \ingroup TaskModelInt
+   *
+   */
+  /** \brief Post propagator for knapsack
+   *
+   * Items \f$i\f$ with weight \f$w_i\f$ and profit \f$p_i\f$ are
+   * selected by \f$x_i\f$. Posts the constraints
+   * \f$\sum_{i=0}^{|x|-1}w_i\cdot x_i=y\f$ and
+   * \f$\sum_{i=0}^{|x|-1}p_i\cdot x_i=z\f$ as linear constraints and
+   * in addition a propagator that reasons on both constraints together
+   * by dynamic programming over the possible weights.
+   *
+   * Each propagation takes time and memory linear in the number of
+   * unassigned items times the largest possible remaining total
+   * weight, as the tables are recomputed. If the number of items
+   * plus one times the smaller of the upper bound of \a y and the sum
+   * of weights plus one exceeds \f$2^{20}\f$, only the linear
+   * constraints are posted.
+   *
+   * The propagation follows: Michael A. Trick. A Dynamic Programming
+   * Approach for Consistency and Propagation for Knapsack Constraints.
+   * CPAIOR 2001.
+   *
+   * Throws the following exceptions:
+   *  - Of type Int::ArgumentSizeMismatch if \a w, \a p, and \a x are
+   *    not of the same size.
+   *  - Of type Int::OutOfLimits if \a w contains a negative number or
+   *    if the sum of weights or the sum of absolute profits exceeds
+   *    the limits for integers.
+   *
+   * \ingroup TaskModelIntKnapsack
+   */
+  GECODE_INT_EXPORT void
+  knapsack(Home home, const IntArgs& w, const IntArgs& p,
+           const BoolVarArgs& x, IntVar y, IntVar z,
+           IntPropLevel ipl=IPL_DEF);
+
+
   /**
    * \defgroup TaskModelIntGeoPacking Geometrical packing constraints
    * \ingroup TaskModelInt
@@ -3196,7 +3289,12 @@ namespace Gecode {
    * \param at_most \a at_most tells if the amount of resources used
    *                for a machine should be less than the limit (\a at_most
    *                = true) or greater than the limit (\a at_most = false)
-   * \param ipl Supports value-consistency only (\a ipl = IPL_VAL, default).
+   * \param ipl Supports value-consistency (\a ipl = IPL_VAL, default).
+   *            If \a IPL_ADVANCED is set and \a at_most is true, an
+   *            additional propagator checks the compulsory parts
+   *            against the capacity of all machines together for
+   *            overload and performs energetic reasoning for single
+   *            machines and all machines together.
    *
    * \exception Int::ArgumentSizeMismatch thrown if the sizes
    *            of the arguments representing tasks does not match.
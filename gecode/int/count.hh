@@ -137,9 +137,11 @@ namespace Gecode { namespace Int { namespace Count {
   template<class VX, class VY>
   class IntBase : public Propagator {
   protected:
-    /// Views still to count
+    /// Council of advisors for views with subscriptions
+    Council<ViewAdvisor<VX> > co;
+    /// Views still to count that have no subscriptions
     ViewArray<VX> x;
-    /// Views from x[0] ... x[n_s-1] have subscriptions
+    /// Number of views still to count that have subscriptions
     int n_s;
     /// View to compare to
     VY y;
@@ -147,8 +149,16 @@ namespace Gecode { namespace Int { namespace Count {
     int c;
     /// Constructor for cloning \a p
     IntBase(Space& home, IntBase& p);
-    /// Constructor for creation
+    /// Constructor for creation (subscribes to \a n_s views in \a x)
     IntBase(Home home, ViewArray<VX>& x, int n_s, VY y, int c);
+    /// Eliminate view of advisor \a a if decided and return whether it was
+    bool decided(Space& home, ViewAdvisor<VX>& a);
+    /// Eliminate all decided views and return number of views still to count
+    int eliminate(Space& home);
+    /// Create subscriptions until \a m views have subscriptions
+    void watch(Space& home, int m);
+    /// Move all views still to count to \a x and cancel subscriptions
+    void unwatch(Space& home);
   public:
     /// Cost function (defined as low linear)
     virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
@@ -175,6 +185,10 @@ namespace Gecode { namespace Int { namespace Count {
     using IntBase<VX,VY>::n_s;
     using IntBase<VX,VY>::y;
     using IntBase<VX,VY>::c;
+    using IntBase<VX,VY>::decided;
+    using IntBase<VX,VY>::eliminate;
+    using IntBase<VX,VY>::watch;
+    using IntBase<VX,VY>::unwatch;
     /// Constructor for cloning \a p
     EqInt(Space& home, EqInt& p);
     /// Constructor for creation
@@ -182,6 +196,8 @@ namespace Gecode { namespace Int { namespace Count {
   public:
     /// Create copy during cloning
     virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator for \f$\#\{i\in\{0,\ldots,|x|-1\}\;|\;x_i=y\}=c\f$
@@ -205,6 +221,10 @@ namespace Gecode { namespace Int { namespace Count {
     using IntBase<VX,VY>::n_s;
     using IntBase<VX,VY>::y;
     using IntBase<VX,VY>::c;
+    using IntBase<VX,VY>::decided;
+    using IntBase<VX,VY>::eliminate;
+    using IntBase<VX,VY>::watch;
+    using IntBase<VX,VY>::unwatch;
     /// Constructor for cloning \a p
     GqInt(Space& home, GqInt& p);
     /// Constructor for creation
@@ -212,6 +232,8 @@ namespace Gecode { namespace Int { namespace Count {
   public:
     /// Create copy during cloning
     virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator for \f$\#\{i\in\{0,\ldots,|x|-1\}\;|\;x_i=y\}\geq c\f$
@@ -235,6 +257,10 @@ namespace Gecode { namespace Int { namespace Count {
     using IntBase<VX,VY>::n_s;
     using IntBase<VX,VY>::y;
     using IntBase<VX,VY>::c;
+    using IntBase<VX,VY>::decided;
+    using IntBase<VX,VY>::eliminate;
+    using IntBase<VX,VY>::watch;
+    using IntBase<VX,VY>::unwatch;
     /// Constructor for cloning \a p
     LqInt(Space& home, LqInt& p);
     /// Constructor for creation
@@ -242,6 +268,8 @@ namespace Gecode { namespace Int { namespace Count {
   public:
     /// Create copy during cloning
     virtual Actor* copy(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
     /// Perform propagation
     virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
     /// Post propagator for \f$\#\{i\in\{0,\ldots,|x|-1\}\;|\;x_i=y\}\leq c\f$
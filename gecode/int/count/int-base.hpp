@@ -37,11 +37,12 @@ namespace Gecode { namespace Int { namespace Count {
   forceinline
   IntBase<VX,VY>::IntBase(Home home,
                           ViewArray<VX>& x0, int n_s0, VY y0, int c0)
-    : Propagator(home), x(x0), n_s(n_s0), y(y0), c(c0) {
+    : Propagator(home), co(home), x(x0), n_s(n_s0), y(y0), c(c0) {
     if (isintset(y))
       home.notice(*this,AP_DISPOSE);
     for (int i=0; i<n_s; i++)
-      x[i].subscribe(home,*this,PC_INT_DOM);
+      (void) new (home) ViewAdvisor<VX>(home,*this,co,x[i]);
+    x.drop_fst(n_s);
     subscribe(home,*this,y);
   }
 
@@ -50,8 +51,7 @@ namespace Gecode { namespace Int { namespace Count {
   IntBase<VX,VY>::dispose(Space& home) {
     if (isintset(y))
       home.ignore(*this,AP_DISPOSE);
-    for (int i=0; i<n_s; i++)
-      x[i].cancel(home,*this,PC_INT_DOM);
+    co.dispose(home);
     cancel(home,*this,y);
     (void) Propagator::dispose(home);
     return sizeof(*this);
@@ -61,6 +61,7 @@ namespace Gecode { namespace Int { namespace Count {
   forceinline
   IntBase<VX,VY>::IntBase(Space& home, IntBase<VX,VY>& p)
     : Propagator(home,p), n_s(p.n_s), c(p.c) {
+    co.update(home,p.co);
     x.update(home,p.x);
     update(y,home,p.y);
   }
@@ -68,17 +69,76 @@ namespace Gecode { namespace Int { namespace Count {
   template<class VX, class VY>
   PropCost
   IntBase<VX,VY>::cost(const Space&, const ModEventDelta&) const {
-    return PropCost::linear(PropCost::LO,x.size());
+    return PropCost::linear(PropCost::LO,n_s+x.size());
   }
 
   template<class VX, class VY>
   void
   IntBase<VX,VY>::reschedule(Space& home) {
-    for (int i=0; i<n_s; i++)
-      x[i].reschedule(home,*this,PC_INT_DOM);
+    VX::schedule(home,*this,ME_INT_DOM);
     Gecode::Int::Count::reschedule(home,*this,y);
   }
 
+  template<class VX, class VY>
+  forceinline bool
+  IntBase<VX,VY>::decided(Space& home, ViewAdvisor<VX>& a) {
+    switch (holds(a.view(),y)) {
+    case RT_FALSE:
+      break;
+    case RT_TRUE:
+      c--; break;
+    case RT_MAYBE:
+      return false;
+    default:
+      GECODE_NEVER;
+    }
+    a.dispose(home,co); n_s--;
+    return true;
+  }
+
+  template<class VX, class VY>
+  forceinline int
+  IntBase<VX,VY>::eliminate(Space& home) {
+    // Eliminate decided views from views with subscriptions
+    for (Advisors<ViewAdvisor<VX> > as(co); as(); ++as)
+      (void) decided(home,as.advisor());
+    // Eliminate decided views from views without subscriptions
+    int n_x = x.size();
+    for (int i=n_x; i--; )
+      switch (holds(x[i],y)) {
+      case RT_FALSE: x[i]=x[--n_x]; break;
+      case RT_TRUE:  x[i]=x[--n_x]; c--; break;
+      case RT_MAYBE: break;
+      default:       GECODE_NEVER;
+      }
+    x.size(n_x);
+    return n_s + n_x;
+  }
+
+  template<class VX, class VY>
+  forceinline void
+  IntBase<VX,VY>::watch(Space& home, int m) {
+    assert(m <= n_s + x.size());
+    int n_x = x.size();
+    for ( ; n_s < m; n_s++)
+      (void) new (home) ViewAdvisor<VX>(home,*this,co,x[--n_x]);
+    x.size(n_x);
+  }
+
+  template<class VX, class VY>
+  forceinline void
+  IntBase<VX,VY>::unwatch(Space& home) {
+    ViewArray<VX> z(home,n_s+x.size());
+    int j=0;
+    for (Advisors<ViewAdvisor<VX> > as(co); as(); ++as) {
+      z[j++] = as.advisor().view();
+      as.advisor().dispose(home,co);
+    }
+    for (int i=0; i<x.size(); i++)
+      z[j++] = x[i];
+    x = z; n_s = 0;
+  }
+
 }}}
 
 // STATISTICS: int-prop
@@ -82,55 +82,35 @@ namespace Gecode { namespace Int { namespace Count {
     return new (home) EqInt<VX,VY>(home,*this);
   }
 
+  template<class VX, class VY>
+  ExecStatus
+  EqInt<VX,VY>::advise(Space& home, Advisor& a, const Delta&) {
+    if (!decided(home,static_cast<ViewAdvisor<VX>&>(a)))
+      return ES_FIX;
+    // Propagate only if the views with subscriptions might not suffice
+    int n_x = n_s + x.size();
+    return (n_s > std::max(c,n_x-c)) ? ES_FIX : ES_NOFIX;
+  }
+
   template<class VX, class VY>
   ExecStatus
   EqInt<VX,VY>::propagate(Space& home, const ModEventDelta&) {
-    // Eliminate decided views from subscribed views
-    int n_x = x.size();
-    for (int i=n_s; i--; )
-      switch (holds(x[i],y)) {
-      case RT_FALSE:
-        x[i].cancel(home,*this,PC_INT_DOM);
-        x[i]=x[--n_s]; x[n_s]=x[--n_x];
-        break;
-      case RT_TRUE:
-        x[i].cancel(home,*this,PC_INT_DOM);
-        x[i]=x[--n_s]; x[n_s]=x[--n_x]; c--;
-        break;
-      case RT_MAYBE:
-        break;
-      default:
-        GECODE_NEVER;
-      }
-    x.size(n_x);
-    if ((c < 0) || (c > n_x))
-      return ES_FAILED;
-    // Eliminate decided views from unsubscribed views
-    for (int i=n_x; i-- > n_s; )
-      switch (holds(x[i],y)) {
-      case RT_FALSE: x[i]=x[--n_x]; break;
-      case RT_TRUE:  x[i]=x[--n_x]; c--; break;
-      case RT_MAYBE: break;
-      default:       GECODE_NEVER;
-      }
-    x.size(n_x);
+    int n_x = eliminate(home);
     if ((c < 0) || (c > n_x))
       return ES_FAILED;
     if (c == 0) {
       // All views must be different
+      unwatch(home);
       GECODE_ES_CHECK(post_false(home,x,y));
       return home.ES_SUBSUMED(*this);
     }
     if (c == n_x) {
       // All views must be equal
+      unwatch(home);
       GECODE_ES_CHECK(post_true(home,x,y));
       return home.ES_SUBSUMED(*this);
     }
-    int m = std::max(c,n_x-c)+1;
-    assert(m <= n_x);
-    // Now, there must be new subscriptions from x[n_s] up to x[m-1]
-    while (n_s < m)
-      x[n_s++].subscribe(home,*this,PC_INT_DOM,false);
+    watch(home,std::max(c,n_x-c)+1);
     return ES_FIX;
   }
 
@@ -77,53 +77,31 @@ namespace Gecode { namespace Int { namespace Count {
     return new (home) LqInt<VX,VY>(home,*this);
   }
 
+  template<class VX, class VY>
+  ExecStatus
+  LqInt<VX,VY>::advise(Space& home, Advisor& a, const Delta&) {
+    if (!decided(home,static_cast<ViewAdvisor<VX>&>(a)))
+      return ES_FIX;
+    // Propagate only if the views with subscriptions might not suffice
+    int n_x = n_s + x.size();
+    return ((n_s > n_x-c) && (c < n_x)) ? ES_FIX : ES_NOFIX;
+  }
+
   template<class VX, class VY>
   ExecStatus
   LqInt<VX,VY>::propagate(Space& home, const ModEventDelta&) {
-    // Eliminate decided views from subscribed views
-    int n_x = x.size();
-    for (int i=n_s; i--; )
-      switch (holds(x[i],y)) {
-      case RT_FALSE:
-        x[i].cancel(home,*this,PC_INT_DOM);
-        x[i]=x[--n_s]; x[n_s]=x[--n_x];
-        break;
-      case RT_TRUE:
-        x[i].cancel(home,*this,PC_INT_DOM);
-        x[i]=x[--n_s]; x[n_s]=x[--n_x]; c--;
-        break;
-      case RT_MAYBE:
-        break;
-      default:
-        GECODE_NEVER;
-      }
-    x.size(n_x);
-    if (c < 0)
-      return ES_FAILED;
-    if (c >= n_x)
-      return home.ES_SUBSUMED(*this);
-    // Eliminate decided views from unsubscribed views
-    for (int i=n_x; i-- > n_s; )
-      switch (holds(x[i],y)) {
-      case RT_FALSE: x[i]=x[--n_x]; break;
-      case RT_TRUE:  x[i]=x[--n_x]; c--; break;
-      case RT_MAYBE: break;
-      default:       GECODE_NEVER;
-      }
-    x.size(n_x);
+    int n_x = eliminate(home);
     if (c < 0)
       return ES_FAILED;
     if (c >= n_x)
       return home.ES_SUBSUMED(*this);
     if (c == 0) {
       // All views must be different
+      unwatch(home);
       GECODE_ES_CHECK(post_false(home,x,y));
       return home.ES_SUBSUMED(*this);
     }
-    // Now, there must be new subscriptions from x[n_s] up to x[n_x-c+1]
-    int m = n_x-c;
-    while (n_s <= m)
-      x[n_s++].subscribe(home,*this,PC_INT_DOM,false);
+    watch(home,n_x-c+1);
     return ES_FIX;
   }
 
@@ -63,8 +63,13 @@ namespace Gecode { namespace Int { namespace Cumulative {
 
     Region r;
 
+    // Tasks with larger usage than the capacity can be pruned anywhere
+    int k = 0;
+    while ((k < t.size()) && (t[k].c() > ccur))
+      k++;
+
     bool assigned;
-    if (Event* e = Event::events(r,t,assigned)) {
+    if (Event* e = Event::events(r,t,assigned,k)) {
       // Set of current but not required tasks
       Support::BitSet<Region> tasks(r,static_cast<unsigned int>(t.size()));
 
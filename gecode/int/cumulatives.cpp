@@ -74,7 +74,7 @@ namespace Gecode {
                      const IntVarArgs& s, const Processing& p,
                      const IntVarArgs& e, const Usage& u,
                      const IntArgs& c, bool at_most,
-                     IntPropLevel) {
+                     IntPropLevel ipl) {
       if (m.size() != s.size()  ||
           s.size() != p.size() ||
           p.size() != e.size()   ||
@@ -96,13 +96,20 @@ namespace Gecode {
       for (int i=0; i<c.size(); i++)
         c_s[i] = c[i];
 
-      // There is only the value-consistent propagator for this constraint
       GECODE_ES_FAIL((Int::Cumulatives::Val<
                            typename ViewType<Machine>::Result,
                            typename ViewType<Processing>::Result,
                            typename ViewType<Usage>::Result,
                            IntView>::post(home, vm,vs,vp,ve,vu,c_s,at_most)));
 
+      // Energetic reasoning is only available for upper limits
+      if (at_most && (ba(ipl) & IPL_ADVANCED))
+        GECODE_ES_FAIL((Int::Cumulatives::Energy<
+                             typename ViewType<Machine>::Result,
+                             typename ViewType<Processing>::Result,
+                             typename ViewType<Usage>::Result,
+                             IntView>::post(home, vm,vs,vp,ve,vu,c_s)));
+
     }
   }
 
@@ -121,9 +121,66 @@ namespace Gecode { namespace Int { namespace Cumulatives {
   };
 
 
+  /**
+   * \brief %Propagator for energetic reasoning in the cumulatives constraint
+   *
+   * The propagator only performs propagation for resource limits
+   * that are upper bounds and while all resource usages are
+   * non-negative. It checks the compulsory parts aggregated over all
+   * machines for overload of their total capacity (which only detects
+   * failure and prunes no times) and checks the energy required by
+   * the tasks in intervals against the capacity of each machine and
+   * of all machines together. Machines are removed from a task if
+   * they cannot accommodate the task's energy.
+   *
+   * Requires \code #include <gecode/int/cumulatives.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class ViewM, class ViewP, class ViewU, class View>
+  class Energy : public Propagator {
+  protected:
+    /// Machines
+    ViewArray<ViewM>  m;
+    /// Start times
+    ViewArray<View>   s;
+    /// Processing times
+    ViewArray<ViewP>  p;
+    /// End times
+    ViewArray<View>   e;
+    /// Resource usages
+    ViewArray<ViewU>  u;
+    /// Machine capacities
+    SharedArray<int>  c;
+    /// Constructor for cloning \a p
+    Energy(Space& home, Energy<ViewM,ViewP,ViewU,View>& p);
+    /// Constructor for creation
+    Energy(Home home, const ViewArray<ViewM>& m, const ViewArray<View>& s,
+           const ViewArray<ViewP>& p, const ViewArray<View>& e,
+           const ViewArray<ViewU>& u, const SharedArray<int>& c);
+    /// Return minimal energy of task \a t in interval from \a a to \a b
+    long long int energy(int t, int a, int b) const;
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as low cubic)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator
+    static ExecStatus post(Home home, const ViewArray<ViewM>& m,
+                           const ViewArray<View>& s, const ViewArray<ViewP>& p,
+                           const ViewArray<View>& e, const ViewArray<ViewU>& u,
+                           const SharedArray<int>& c);
+    /// Dispose propagator
+    virtual size_t dispose(Space& home);
+  };
+
 }}}
 
 #include <gecode/int/cumulatives/val.hpp>
+#include <gecode/int/cumulatives/energy.hpp>
 
 #endif
 
@@ -0,0 +1,261 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Cumulatives {
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline
+  Energy<ViewM,ViewP,ViewU,View>::Energy(Home home,
+                                         const ViewArray<ViewM>& m0,
+                                         const ViewArray<View>& s0,
+                                         const ViewArray<ViewP>& p0,
+                                         const ViewArray<View>& e0,
+                                         const ViewArray<ViewU>& u0,
+                                         const SharedArray<int>& c0)
+    : Propagator(home), m(m0), s(s0), p(p0), e(e0), u(u0), c(c0) {
+    home.notice(*this,AP_DISPOSE);
+
+    m.subscribe(home,*this,Int::PC_INT_VAL);
+    s.subscribe(home,*this,Int::PC_INT_BND);
+    p.subscribe(home,*this,Int::PC_INT_BND);
+    e.subscribe(home,*this,Int::PC_INT_BND);
+    u.subscribe(home,*this,Int::PC_INT_BND);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  ExecStatus
+  Energy<ViewM,ViewP,ViewU,View>
+  ::post(Home home, const ViewArray<ViewM>& m,
+         const ViewArray<View>& s, const ViewArray<ViewP>& p,
+         const ViewArray<View>& e, const ViewArray<ViewU>& u,
+         const SharedArray<int>& c) {
+    (void) new (home) Energy(home,m,s,p,e,u,c);
+    return ES_OK;
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline
+  Energy<ViewM,ViewP,ViewU,View>::Energy(Space& home,
+                                         Energy<ViewM,ViewP,ViewU,View>& ep)
+    : Propagator(home,ep), c(ep.c) {
+    m.update(home,ep.m);
+    s.update(home,ep.s);
+    p.update(home,ep.p);
+    e.update(home,ep.e);
+    u.update(home,ep.u);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  size_t
+  Energy<ViewM,ViewP,ViewU,View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    if (!home.failed()) {
+      m.cancel(home,*this,Int::PC_INT_VAL);
+      s.cancel(home,*this,Int::PC_INT_BND);
+      p.cancel(home,*this,Int::PC_INT_BND);
+      e.cancel(home,*this,Int::PC_INT_BND);
+      u.cancel(home,*this,Int::PC_INT_BND);
+    }
+    c.~SharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  PropCost
+  Energy<ViewM,ViewP,ViewU,View>::cost(const Space&,
+                                       const ModEventDelta&) const {
+    return PropCost::cubic(PropCost::LO, s.size());
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  void
+  Energy<ViewM,ViewP,ViewU,View>::reschedule(Space& home) {
+    m.reschedule(home,*this,Int::PC_INT_VAL);
+    s.reschedule(home,*this,Int::PC_INT_BND);
+    p.reschedule(home,*this,Int::PC_INT_BND);
+    e.reschedule(home,*this,Int::PC_INT_BND);
+    u.reschedule(home,*this,Int::PC_INT_BND);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  Actor*
+  Energy<ViewM,ViewP,ViewU,View>::copy(Space& home) {
+    return new (home) Energy<ViewM,ViewP,ViewU,View>(home,*this);
+  }
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  forceinline long long int
+  Energy<ViewM,ViewP,ViewU,View>::energy(int t, int a, int b) const {
+    // Minimal overlap of task t with the interval [a,b)
+    long long int o =
+      std::min(std::min(static_cast<long long int>(b)-a,
+                        static_cast<long long int>(p[t].min())),
+               std::min(static_cast<long long int>(e[t].min())-a,
+                        static_cast<long long int>(b)-s[t].max()));
+    return (o > 0) ? o * u[t].min() : 0LL;
+  }
+
+  /// Event for the aggregated compulsory part profile
+  class ProfileEvent {
+  public:
+    /// The date of the event
+    int date;
+    /// The change in resource usage
+    int inc;
+    /// Order events by date, decrements first
+    bool operator <(const ProfileEvent& pe) const {
+      return (date == pe.date) ? (inc < pe.inc) : (date < pe.date);
+    }
+  };
+
+  template<class ViewM, class ViewP, class ViewU, class View>
+  ExecStatus
+  Energy<ViewM,ViewP,ViewU,View>::propagate(Space& home,
+                                            const ModEventDelta&) {
+    int n = s.size();
+    int nm = c.size();
+
+    bool assigned = true;
+    for (int t=0; t<n; t++)
+      if (!(m[t].assigned() && s[t].assigned() && p[t].assigned() &&
+            e[t].assigned() && u[t].assigned())) {
+        assigned = false; break;
+      }
+    if (assigned)
+      return home.ES_SUBSUMED(*this);
+
+    // Energetic reasoning is only valid for non-negative resource usage
+    for (int t=0; t<n; t++)
+      if (u[t].min() < 0)
+        return ES_FIX;
+
+    Region r;
+
+    // Capacity of each machine and of all machines together
+    long long int* cap = r.alloc<long long int>(nm);
+    long long int ccap = 0;
+    for (int i=0; i<nm; i++) {
+      cap[i] = std::max(c[i],0);
+      ccap += cap[i];
+    }
+
+    // Tasks that consume resources and can only use the given machines
+    int* tasks = r.alloc<int>(n);
+    int k = 0;
+    for (int t=0; t<n; t++)
+      if ((u[t].min() > 0) && (p[t].min() > 0) &&
+          (m[t].min() >= 0) && (m[t].max() < nm))
+        tasks[k++] = t;
+    if (k == 0)
+      return ES_FIX;
+
+    // Overload check for the compulsory parts aggregated over all machines
+    {
+      ProfileEvent* pe = r.alloc<ProfileEvent>(2*k);
+      int l = 0;
+      for (int i=0; i<k; i++) {
+        int t = tasks[i];
+        if (s[t].max() < e[t].min()) {
+          pe[l].date = s[t].max(); pe[l].inc = u[t].min(); l++;
+          pe[l].date = e[t].min(); pe[l].inc = -u[t].min(); l++;
+        }
+      }
+      Support::quicksort(pe,l);
+      long long int su = 0;
+      for (int i=0; i<l; i++) {
+        su += pe[i].inc;
+        if (su > ccap)
+          return ES_FAILED;
+      }
+    }
+
+    // Candidate bounds for the energetic intervals
+    int* lo = r.alloc<int>(k);
+    int* up = r.alloc<int>(k);
+    for (int i=0; i<k; i++) {
+      lo[i] = s[tasks[i]].min(); up[i] = e[tasks[i]].max();
+    }
+    Support::quicksort(lo,k);
+    Support::quicksort(up,k);
+    int nlo = static_cast<int>(std::unique(lo,lo+k) - lo);
+    int nup = static_cast<int>(std::unique(up,up+k) - up);
+
+    // Energy of tasks assigned to each machine
+    long long int* el = r.alloc<long long int>(nm);
+
+    for (int i=0; i<nlo; i++)
+      for (int j=0; j<nup; j++) {
+        int a = lo[i], b = up[j];
+        if (a >= b)
+          continue;
+        long long int w = static_cast<long long int>(b) - a;
+        long long int ea = 0;
+        for (int l=0; l<nm; l++)
+          el[l] = 0;
+        for (int l=0; l<k; l++) {
+          int t = tasks[l];
+          long long int et = energy(t,a,b);
+          ea += et;
+          if (m[t].assigned())
+            el[m[t].val()] += et;
+        }
+        // Check all machines together
+        if (ea > ccap * w)
+          return ES_FAILED;
+        // Check single machines
+        for (int l=0; l<nm; l++)
+          if (el[l] > cap[l] * w)
+            return ES_FAILED;
+        // Remove machines that cannot accommodate a task
+        for (int l=0; l<k; l++) {
+          int t = tasks[l];
+          if (m[t].assigned())
+            continue;
+          long long int et = energy(t,a,b);
+          if (et == 0)
+            continue;
+          for (int q=m[t].min(); q<=m[t].max(); q++)
+            if (m[t].in(q) && (el[q] + et > cap[q] * w))
+              GECODE_ME_CHECK(m[t].nq(home,q));
+        }
+      }
+
+    return ES_NOFIX;
+  }
+
+}}}
+
+// STATISTICS: int-prop
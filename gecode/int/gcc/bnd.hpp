@@ -629,12 +629,12 @@ namespace Gecode { namespace Int { namespace GCC {
 
     if (Card::propagate) {
       // before propagation performs inferences on cardinality variables:
-      if (noa > 0)
+      if (noa > 0) {
         for (int i = k.size(); i--; )
-          if (!k[i].assigned()) {
+          if (!k[i].assigned())
             GECODE_ME_CHECK(k[i].lq(home, x.size() - (noa - count[i])));
-            GECODE_ME_CHECK(k[i].gq(home, count[i]));
-          }
+        GECODE_ES_CHECK(k.gq(home, count));
+      }
 
       if (!card_consistent<Card>(x, k))
         return ES_FAILED;
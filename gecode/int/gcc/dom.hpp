@@ -147,12 +147,12 @@ namespace Gecode { namespace Int { namespace GCC {
 
     // before propagation performs inferences on cardinality variables:
     if (Card::propagate) {
-      if (noa > 0)
+      if (noa > 0) {
         for (int i = k.size(); i--; )
-          if (!k[i].assigned()) {
+          if (!k[i].assigned())
             GECODE_ME_CHECK(k[i].lq(home, y.size() - (noa - count[i])));
-            GECODE_ME_CHECK(k[i].gq(home, count[i]));
-          }
+        GECODE_ES_CHECK(k.gq(home, count));
+      }
 
       GECODE_ES_CHECK(prop_card<Card>(home,y,k));
       if (!card_consistent<Card>(y,k))
@@ -0,0 +1,75 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/knapsack.hh>
+
+#include <algorithm>
+
+namespace Gecode {
+
+  void
+  knapsack(Home home, const IntArgs& w, const IntArgs& p,
+           const BoolVarArgs& x, IntVar y, IntVar z,
+           IntPropLevel ipl) {
+    using namespace Int;
+    if ((w.size() != x.size()) || (p.size() != x.size()))
+      throw ArgumentSizeMismatch("Int::knapsack");
+    long long int sw = 0, sp = 0;
+    for (int i=0; i<x.size(); i++) {
+      Limits::nonnegative(w[i],"Int::knapsack");
+      sw += w[i];
+      sp += (p[i] < 0) ? -static_cast<long long int>(p[i]) : p[i];
+    }
+    Limits::check(sw,"Int::knapsack");
+    Limits::check(sp,"Int::knapsack");
+
+    // The linear constraints are cheap and prune before the knapsack
+    linear(home,w,x,IRT_EQ,y,ipl);
+    linear(home,p,x,IRT_EQ,z,ipl);
+
+    GECODE_POST;
+
+    // Only post the propagator if its tables are small enough
+    long long int cap = std::min(sw,static_cast<long long int>(y.max()));
+    if ((x.size()+1LL) * (std::max(cap,0LL)+1LL) > Knapsack::max_entries)
+      return;
+
+    ViewArray<BoolView> xv(home,x);
+    SharedArray<int> wv(w), pv(p);
+    GECODE_ES_FAIL(Knapsack::Knapsack::post(home,xv,y,z,wv,pv));
+  }
+
+}
+
+// STATISTICS: int-post
@@ -0,0 +1,131 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#ifndef __GECODE_INT_KNAPSACK_HH__
+#define __GECODE_INT_KNAPSACK_HH__
+
+#include <gecode/int.hh>
+
+/**
+ * \namespace Gecode::Int::Knapsack
+ * \brief %Knapsack propagators
+ */
+
+namespace Gecode { namespace Int { namespace Knapsack {
+
+  /**
+   * \brief Largest size of the dynamic programming tables
+   *
+   * The propagator is only posted if the number of items plus one
+   * times the largest possible total weight plus one does not exceed
+   * this number of table entries.
+   */
+  const long long int max_entries = 1LL << 20;
+
+  /**
+   * \brief %Knapsack propagator
+   *
+   * Propagates \f$\sum_i w_i\cdot x_i=y\f$ and
+   * \f$\sum_i p_i\cdot x_i=z\f$ together by dynamic programming over
+   * the possible weights. For each weight the largest and smallest
+   * profit of a selection of items with exactly that weight are
+   * computed, once over the items from the first and once over the
+   * items from the last. A value for \f$x_i\f$ is pruned if there is
+   * no weight \f$c\f$ of the items before the item such that the
+   * largest profit of completing \f$c\f$ to a total weight in the
+   * bounds of \f$y\f$ is at least the lower bound of \f$z\f$ and the
+   * smallest such profit is at most the upper bound of \f$z\f$. As
+   * only profit bounds are compared, a value may be kept even if no
+   * profit between the bounds is possible. The bounds of \a y and
+   * \a z are pruned accordingly.
+   *
+   * Each propagation recomputes two tables of size linear in the
+   * number of unassigned items times the largest remaining weight,
+   * so time and memory per propagation are linear in that product.
+   *
+   * The algorithm follows: Michael A. Trick. A Dynamic Programming
+   * Approach for Consistency and Propagation for Knapsack Constraints.
+   * CPAIOR 2001.
+   *
+   * Requires \code #include <gecode/int/knapsack.hh> \endcode
+   *
+   * \ingroup FuncIntProp
+   */
+  class Knapsack : public Propagator {
+  protected:
+    /// Items to be selected
+    ViewArray<BoolView> x;
+    /// Total weight of selected items
+    IntView y;
+    /// Total profit of selected items
+    IntView z;
+    /// Weights of items (non-negative)
+    SharedArray<int> w;
+    /// Profits of items
+    SharedArray<int> p;
+    /// Constructor for posting
+    Knapsack(Home home, ViewArray<BoolView>& x, IntView y, IntView z,
+             SharedArray<int>& w, SharedArray<int>& p);
+    /// Constructor for cloning \a p
+    Knapsack(Space& home, Knapsack& p);
+  public:
+    /// Post propagator
+    GECODE_INT_EXPORT
+    static ExecStatus post(Home home, ViewArray<BoolView>& x,
+                           IntView y, IntView z,
+                           SharedArray<int>& w, SharedArray<int>& p);
+    /// Perform propagation
+    GECODE_INT_EXPORT
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Cost function (defined as high quadratic)
+    GECODE_INT_EXPORT
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    GECODE_INT_EXPORT
+    virtual void reschedule(Space& home);
+    /// Copy propagator during cloning
+    GECODE_INT_EXPORT
+    virtual Actor* copy(Space& home);
+    /// Delete propagator and return its size
+    GECODE_INT_EXPORT
+    virtual size_t dispose(Space& home);
+  };
+
+}}}
+
+#include <gecode/int/knapsack/propagate.hpp>
+
+#endif
+
+// STATISTICS: int-prop
@@ -0,0 +1,219 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/int/knapsack.hh>
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Knapsack {
+
+  /*
+   * Knapsack propagator
+   *
+   */
+
+  PropCost
+  Knapsack::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::quadratic(PropCost::HI,x.size());
+  }
+
+  void
+  Knapsack::reschedule(Space& home) {
+    x.reschedule(home,*this,PC_BOOL_VAL);
+    y.reschedule(home,*this,PC_INT_BND);
+    z.reschedule(home,*this,PC_INT_BND);
+  }
+
+  Actor*
+  Knapsack::copy(Space& home) {
+    return new (home) Knapsack(home,*this);
+  }
+
+  size_t
+  Knapsack::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    x.cancel(home,*this,PC_BOOL_VAL);
+    y.cancel(home,*this,PC_INT_BND);
+    z.cancel(home,*this,PC_INT_BND);
+    w.~SharedArray();
+    p.~SharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  ExecStatus
+  Knapsack::propagate(Space& home, const ModEventDelta&) {
+    // Profit for weights that cannot be reached
+    const int no_max = INT_MIN;
+    const int no_min = INT_MAX;
+
+    Region r;
+
+    // Collect unassigned items, weight and profit of selected items
+    int* u = r.alloc<int>(x.size());
+    int m = 0, fw = 0, fp = 0, tw = 0;
+    for (int i=0; i<x.size(); i++)
+      if (x[i].one()) {
+        fw += w[i]; fp += p[i];
+      } else if (x[i].none()) {
+        u[m++] = i; tw += w[i];
+      }
+
+    // Weights and profits possible for the unassigned items
+    int lo = static_cast<int>
+      (std::max(static_cast<long long int>(y.min()) - fw, 0LL));
+    int hi = static_cast<int>
+      (std::min(static_cast<long long int>(y.max()) - fw,
+                static_cast<long long int>(tw)));
+    if (lo > hi)
+      return ES_FAILED;
+    long long int plo = static_cast<long long int>(z.min()) - fp;
+    long long int phi = static_cast<long long int>(z.max()) - fp;
+
+    // Number of weights to consider
+    size_t k = static_cast<size_t>(hi) + 1;
+
+    // Largest and smallest profit for each weight using the first j items
+    int* fmax = r.alloc<int>((m+1)*k);
+    int* fmin = r.alloc<int>((m+1)*k);
+    for (size_t c=0; c<k; c++) {
+      fmax[c] = no_max; fmin[c] = no_min;
+    }
+    fmax[0] = fmin[0] = 0;
+    for (int j=0; j<m; j++) {
+      int* amax = fmax + j*k; int* amin = fmin + j*k;
+      int* bmax = amax + k;   int* bmin = amin + k;
+      size_t wi = static_cast<size_t>(w[u[j]]);
+      int pi = p[u[j]];
+      for (size_t c=0; c<k; c++) {
+        bmax[c] = amax[c]; bmin[c] = amin[c];
+      }
+      for (size_t c=0; c+wi<k; c++)
+        if (amax[c] != no_max) {
+          bmax[c+wi] = std::max(bmax[c+wi],amax[c]+pi);
+          bmin[c+wi] = std::min(bmin[c+wi],amin[c]+pi);
+        }
+    }
+
+    // Largest and smallest profit for each weight using the items after j
+    int* rmax = r.alloc<int>(k);
+    int* rmin = r.alloc<int>(k);
+    for (size_t c=0; c<k; c++)
+      if (c >= static_cast<size_t>(lo)) {
+        rmax[c] = rmin[c] = 0;
+      } else {
+        rmax[c] = no_max; rmin[c] = no_min;
+      }
+
+    // Prune items from the last to the first
+    for (int j=m; j--; ) {
+      int* amax = fmax + j*k; int* amin = fmin + j*k;
+      int i = u[j];
+      size_t wi = static_cast<size_t>(w[i]);
+      int pi = p[i];
+      /*
+       * The item can remain unselected (selected) if for some weight c
+       * of the items before it, the largest profit of completing c
+       * without (with) the item is at least the lower bound and the
+       * smallest profit is at most the upper bound of z.
+       */
+      bool s0 = false;
+      for (size_t c=0; !s0 && (c<k); c++)
+        s0 = (amax[c] != no_max) && (rmax[c] != no_max) &&
+          (amax[c]+rmax[c] >= plo) && (amin[c]+rmin[c] <= phi);
+      bool s1 = false;
+      for (size_t c=0; !s1 && (c+wi<k); c++)
+        s1 = (amax[c] != no_max) && (rmax[c+wi] != no_max) &&
+          (amax[c]+pi+rmax[c+wi] >= plo) && (amin[c]+pi+rmin[c+wi] <= phi);
+      if (!s0 && !s1)
+        return ES_FAILED;
+      if (!s0) {
+        GECODE_ME_CHECK(x[i].one(home));
+        for (size_t c=0; c<k; c++)
+          if ((c+wi < k) && (rmax[c+wi] != no_max)) {
+            rmax[c] = rmax[c+wi]+pi; rmin[c] = rmin[c+wi]+pi;
+          } else {
+            rmax[c] = no_max; rmin[c] = no_min;
+          }
+      } else if (!s1) {
+        GECODE_ME_CHECK(x[i].zero(home));
+      } else {
+        for (size_t c=0; c+wi<k; c++)
+          if (rmax[c+wi] != no_max) {
+            int rmx = rmax[c+wi]+pi, rmn = rmin[c+wi]+pi;
+            rmax[c] = std::max(rmax[c],rmx);
+            rmin[c] = std::min(rmin[c],rmn);
+          }
+      }
+    }
+
+    // Prune total weight and profit
+    {
+      int* amax = fmax + m*k; int* amin = fmin + m*k;
+      int wl = -1, wh = -1;
+      int pmax = no_max, pmin = no_min;
+      for (size_t c=static_cast<size_t>(lo); c<k; c++)
+        if ((amax[c] != no_max) && (amax[c] >= plo) && (amin[c] <= phi)) {
+          if (wl < 0)
+            wl = static_cast<int>(c);
+          wh = static_cast<int>(c);
+          pmax = std::max(pmax,amax[c]);
+          pmin = std::min(pmin,amin[c]);
+        }
+      if (wl < 0)
+        return ES_FAILED;
+      GECODE_ME_CHECK(y.gq(home,wl+fw));
+      GECODE_ME_CHECK(y.lq(home,wh+fw));
+      GECODE_ME_CHECK(z.gq(home,pmin+fp));
+      GECODE_ME_CHECK(z.lq(home,pmax+fp));
+    }
+
+    return (m == 0) ? home.ES_SUBSUMED(*this) : ES_NOFIX;
+  }
+
+  ExecStatus
+  Knapsack::post(Home home, ViewArray<BoolView>& x, IntView y, IntView z,
+                 SharedArray<int>& w, SharedArray<int>& p) {
+    if (x.size() == 0) {
+      GECODE_ME_CHECK(y.eq(home,0));
+      GECODE_ME_CHECK(z.eq(home,0));
+      return ES_OK;
+    }
+    (void) new (home) Knapsack(home,x,y,z,w,p);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
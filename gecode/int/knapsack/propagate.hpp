@@ -0,0 +1,58 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+namespace Gecode { namespace Int { namespace Knapsack {
+
+  forceinline
+  Knapsack::Knapsack(Home home, ViewArray<BoolView>& x0,
+                     IntView y0, IntView z0,
+                     SharedArray<int>& w0, SharedArray<int>& p0)
+    : Propagator(home), x(x0), y(y0), z(z0), w(w0), p(p0) {
+    home.notice(*this,AP_DISPOSE);
+    x.subscribe(home,*this,PC_BOOL_VAL);
+    y.subscribe(home,*this,PC_INT_BND);
+    z.subscribe(home,*this,PC_INT_BND);
+  }
+
+  forceinline
+  Knapsack::Knapsack(Space& home, Knapsack& q)
+    : Propagator(home,q), w(q.w), p(q.p) {
+    x.update(home,q.x);
+    y.update(home,q.y);
+    z.update(home,q.z);
+  }
+
+}}}
+
+// STATISTICS: int-prop
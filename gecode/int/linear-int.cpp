@@ -185,6 +185,21 @@ namespace Gecode {
     Linear::post(home,t,x.size()+1,irt,0,r);
   }
 
+  void
+  difference(Home home, const IntVarArgs& x,
+             const IntArgs& s, const IntArgs& c, const IntArgs& t,
+             IntPropLevel) {
+    if ((s.size() != c.size()) || (t.size() != c.size()))
+      throw ArgumentSizeMismatch("Int::difference");
+    for (int i=0; i<c.size(); i++)
+      if ((s[i] < 0) || (s[i] >= x.size()) ||
+          (t[i] < 0) || (t[i] >= x.size()))
+        throw OutOfLimits("Int::difference");
+    GECODE_POST;
+    ViewArray<IntView> xv(home,x);
+    GECODE_ES_FAIL(Linear::Difference<IntView>::post(home,xv,s,c,t));
+  }
+
 }
 
 // STATISTICS: int-post
@@ -1326,6 +1326,143 @@ namespace Gecode { namespace Int { namespace Linear {
 
 #include <gecode/int/linear/bool-scale.hpp>
 
+namespace Gecode { namespace Int { namespace Linear {
+
+  /// %Advisor for a watched Boolean view
+  class WatchAdvisor : public Advisor {
+  public:
+    /// Index of the watched view
+    int i;
+    /// Constructor for creation
+    WatchAdvisor(Space& home, Propagator& p, Council<WatchAdvisor>& c, int i);
+    /// Constructor for cloning \a a
+    WatchAdvisor(Space& home, WatchAdvisor& a);
+  };
+
+  /**
+   * \brief %Propagator for greater or equal to Boolean sum with coefficients
+   *
+   * Propagates \f$\sum_{i=0}^{|x|-1}a_i\cdot x_i\geq c\f$ for positive
+   * coefficients \f$a\f$ sorted in decreasing order. Only views whose
+   * coefficients sum up to at least \f$c+a_0\f$ are watched by advisors,
+   * so that assigning an unwatched view does not cost anything. Only
+   * when no more views can be watched the propagator prunes by the slack
+   * of the inequality.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class VX>
+  class GqBoolScale : public Propagator {
+  protected:
+    /// Council of advisors for watched views
+    Council<WatchAdvisor> co;
+    /// Boolean views
+    ViewArray<VX> x;
+    /// Coefficients (in decreasing order)
+    SharedArray<int> a;
+    /// Righthandside
+    long long int c;
+    /// Number of views that have been considered for watching
+    int w;
+    /// Sum of coefficients of watched views not assigned to zero
+    long long int ws;
+    /// Sum of coefficients of watched views assigned to one
+    long long int ts;
+    /// Watch further views, reuse advisor \a r if not NULL
+    bool watch(Space& home, WatchAdvisor* r);
+    /// Constructor for cloning \a p
+    GqBoolScale(Space& home, GqBoolScale& p);
+    /// Constructor for creation
+    GqBoolScale(Home home, ViewArray<VX>& x, const SharedArray<int>& a,
+                long long int c);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as low linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Give advice to propagator
+    virtual ExecStatus advise(Space& home, Advisor& a, const Delta& d);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for \f$\sum_{i=0}^{|x|-1}a_i\cdot x_i\geq c\f$
+    static ExecStatus post(Home home, ViewArray<VX>& x,
+                           const SharedArray<int>& a, long long int c);
+  };
+
+}}}
+
+#include <gecode/int/linear/bool-watch.hpp>
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /**
+   * \brief %Propagator for a network of difference constraints
+   *
+   * Propagates \f$x_{s_i}+c_i\leq x_{t_i}\f$ for all difference
+   * constraints \f$i\f$. Lower bounds are propagated along the
+   * constraints and upper bounds against the constraints with a
+   * queue-based Bellman-Ford algorithm. Hence, bounds are propagated
+   * along paths of arbitrary length in a single run rather than by one
+   * propagator per difference constraint. As the constraints are
+   * checked for cycles of positive length when posting, propagation
+   * always terminates.
+   *
+   * Requires \code #include <gecode/int/linear.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class Difference : public Propagator {
+  protected:
+    /// The views
+    ViewArray<View> x;
+    /// Index of start view of each constraint
+    SharedArray<int> s;
+    /// Constant of each constraint
+    SharedArray<int> c;
+    /// Index of target view of each constraint
+    SharedArray<int> t;
+    /**
+     * \brief Constraints by start view
+     *
+     * The constraints starting at view \f$i\f$ are at positions
+     * \f$o_i\f$ to \f$o_{i+1}-1\f$ after the \f$|x|+1\f$ offsets
+     * \f$o\f$.
+     */
+    SharedArray<int> out;
+    /// Constraints by target view (same layout as \a out)
+    SharedArray<int> in;
+    /// Constructor for cloning \a p
+    Difference(Space& home, Difference& p);
+    /// Constructor for creation
+    Difference(Home home, ViewArray<View>& x,
+               SharedArray<int>& s, SharedArray<int>& c, SharedArray<int>& t,
+               SharedArray<int>& out, SharedArray<int>& in);
+  public:
+    /// Create copy during cloning
+    virtual Actor* copy(Space& home);
+    /// Cost function (defined as high linear)
+    virtual PropCost cost(const Space& home, const ModEventDelta& med) const;
+    /// Schedule function
+    virtual void reschedule(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Delete propagator and return its size
+    virtual size_t dispose(Space& home);
+    /// Post propagator for \f$x_{s_i}+c_i\leq x_{t_i}\f$
+    static ExecStatus post(Home home, ViewArray<View>& x,
+                           const IntArgs& s, const IntArgs& c,
+                           const IntArgs& t);
+  };
+
+}}}
+
+#include <gecode/int/linear/int-diff.hpp>
+
 namespace Gecode { namespace Int { namespace Linear {
 
   /**
@@ -484,11 +484,57 @@ namespace Gecode { namespace Int { namespace Linear {
   }
 
 
+  /// Sort terms in decreasing order of coefficients
+  class TermDec {
+  public:
+    bool
+    operator ()(const Term<BoolView>& x, const Term<BoolView>& y) {
+      return x.a > y.a;
+    }
+  };
+
+  /// Post propagator for \f$\sum_{i=0}^{n-1}a_i\cdot x_i\geq c\f$
+  template<class VX>
+  forceinline void
+  post_watch(Home home, Term<BoolView>* t, int n, long long int c) {
+    TermDec td;
+    Support::quicksort<Term<BoolView>,TermDec>(t,n,td);
+    ViewArray<VX> x(home,n);
+    SharedArray<int> a(n);
+    for (int i=0; i<n; i++) {
+      x[i]=VX(t[i].x); a[i]=t[i].a;
+    }
+    GECODE_ES_FAIL(GqBoolScale<VX>::post(home,x,a,c));
+  }
+
   forceinline void
   post_mixed(Home home,
              Term<BoolView>* t_p, int n_p,
              Term<BoolView>* t_n, int n_n,
              IntRelType irt, ZeroIntView y, int c) {
+    // Inequalities with coefficients of the same sign watch views
+    if ((n_n == 0) && ((irt == IRT_LQ) || (irt == IRT_GQ))) {
+      if (irt == IRT_GQ) {
+        post_watch<BoolView>(home,t_p,n_p,c);
+      } else {
+        long long int s = 0;
+        for (int i=0; i<n_p; i++)
+          s += t_p[i].a;
+        post_watch<NegBoolView>(home,t_p,n_p,s-c);
+      }
+      return;
+    }
+    if ((n_p == 0) && ((irt == IRT_LQ) || (irt == IRT_GQ))) {
+      if (irt == IRT_LQ) {
+        post_watch<BoolView>(home,t_n,n_n,-static_cast<long long int>(c));
+      } else {
+        long long int s = 0;
+        for (int i=0; i<n_n; i++)
+          s += t_n[i].a;
+        post_watch<NegBoolView>(home,t_n,n_n,s+c);
+      }
+      return;
+    }
     ScaleBoolArray b_p(home,n_p);
     {
       ScaleBool* f=b_p.fst();
@@ -0,0 +1,194 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Advisor for watched Boolean views
+   *
+   */
+  forceinline
+  WatchAdvisor::WatchAdvisor(Space& home, Propagator& p,
+                             Council<WatchAdvisor>& c, int i0)
+    : Advisor(home,p,c), i(i0) {}
+  forceinline
+  WatchAdvisor::WatchAdvisor(Space& home, WatchAdvisor& a)
+    : Advisor(home,a), i(a.i) {}
+
+
+  /*
+   * Greater or equal propagator for Boolean sum with coefficients
+   *
+   */
+  template<class VX>
+  forceinline
+  GqBoolScale<VX>::GqBoolScale(Home home, ViewArray<VX>& x0,
+                               const SharedArray<int>& a0, long long int c0)
+    : Propagator(home), co(home), x(x0), a(a0), c(c0), w(0), ws(0), ts(0) {
+    home.notice(*this,AP_DISPOSE);
+    (void) watch(home,NULL);
+  }
+
+  template<class VX>
+  forceinline
+  GqBoolScale<VX>::GqBoolScale(Space& home, GqBoolScale<VX>& p)
+    : Propagator(home,p), a(p.a), c(p.c), w(p.w), ws(p.ws), ts(p.ts) {
+    co.update(home,p.co);
+    x.update(home,p.x);
+  }
+
+  template<class VX>
+  Actor*
+  GqBoolScale<VX>::copy(Space& home) {
+    return new (home) GqBoolScale<VX>(home,*this);
+  }
+
+  template<class VX>
+  PropCost
+  GqBoolScale<VX>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::LO, x.size());
+  }
+
+  template<class VX>
+  forceinline bool
+  GqBoolScale<VX>::watch(Space& home, WatchAdvisor* r) {
+    // Watched views must cover the right hand side plus the largest coefficient
+    while ((ws - a[0] < c) && (w < x.size())) {
+      int i = w++;
+      if (x[i].zero())
+        continue;
+      ws += a[i];
+      if (x[i].one()) {
+        ts += a[i];
+      } else if (r != NULL) {
+        r->i = i; x[i].subscribe(home,*r); r = NULL;
+      } else {
+        WatchAdvisor* n = new (home) WatchAdvisor(home,*this,co,i);
+        x[i].subscribe(home,*n);
+      }
+    }
+    return r == NULL;
+  }
+
+  template<class VX>
+  ExecStatus
+  GqBoolScale<VX>::advise(Space& home, Advisor& _a, const Delta& d) {
+    WatchAdvisor& wa = static_cast<WatchAdvisor&>(_a);
+    if (VX::one(d)) {
+      ts += a[wa.i];
+      return (ts >= c) ? home.ES_NOFIX_DISPOSE(co,wa)
+        : home.ES_FIX_DISPOSE(co,wa);
+    }
+    ws -= a[wa.i];
+    // Try to find replacements, reusing the advisor if possible
+    if (watch(home,&wa))
+      return ((ws - a[0] < c) || (ts >= c)) ? ES_NOFIX : ES_FIX;
+    // Advisor is not needed any longer or no replacement exists
+    if ((ws - a[0] < c) || (ts >= c))
+      return home.ES_NOFIX_DISPOSE(co,wa);
+    else
+      return home.ES_FIX_DISPOSE(co,wa);
+  }
+
+  template<class VX>
+  void
+  GqBoolScale<VX>::reschedule(Space& home) {
+    if ((ws - a[0] < c) || (ts >= c))
+      VX::schedule(home,*this,ME_BOOL_VAL);
+  }
+
+  template<class VX>
+  ExecStatus
+  GqBoolScale<VX>::propagate(Space& home, const ModEventDelta&) {
+    if (ts >= c)
+      return home.ES_SUBSUMED(*this);
+    // Enough views are watched to guarantee consistency
+    if (ws - a[0] >= c)
+      return ES_FIX;
+    // All views that are not zero are watched
+    assert(w == x.size());
+    // Slack of the inequality
+    long long int sl = ws - c;
+    if (sl < 0)
+      return ES_FAILED;
+    // Views with a coefficient larger than the slack must be one
+    for (int i=0; (i < x.size()) && (a[i] > sl); i++)
+      if (x[i].none())
+        GECODE_ME_CHECK(x[i].one_none(home));
+    return (ts >= c) ? home.ES_SUBSUMED(*this) : ES_FIX;
+  }
+
+  template<class VX>
+  forceinline size_t
+  GqBoolScale<VX>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    for (Advisors<WatchAdvisor> as(co); as(); ++as)
+      x[as.advisor().i].cancel(home,as.advisor());
+    co.dispose(home);
+    a.~SharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class VX>
+  ExecStatus
+  GqBoolScale<VX>::post(Home home, ViewArray<VX>& x,
+                        const SharedArray<int>& a, long long int c) {
+    assert(x.size() == a.size());
+    // Sum of coefficients for views assigned to one
+    long long int o = 0;
+    // Views with a coefficient larger than the slack must be one
+    {
+      long long int sl = -c;
+      for (int i=0; i<x.size(); i++)
+        if (!x[i].zero())
+          sl += a[i];
+      if (sl < 0)
+        return ES_FAILED;
+      for (int i=0; (i < x.size()) && (a[i] > sl); i++)
+        if (x[i].none())
+          GECODE_ME_CHECK(x[i].one_none(home));
+      for (int i=0; i<x.size(); i++)
+        if (x[i].one())
+          o += a[i];
+    }
+    // Inequality is subsumed
+    if (o >= c)
+      return ES_OK;
+    (void) new (home) GqBoolScale<VX>(home,x,a,c);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
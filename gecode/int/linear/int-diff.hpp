@@ -0,0 +1,244 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+namespace Gecode { namespace Int { namespace Linear {
+
+  /*
+   * Propagator for a network of difference constraints
+   *
+   */
+  template<class View>
+  forceinline
+  Difference<View>::Difference(Home home, ViewArray<View>& x0,
+                               SharedArray<int>& s0, SharedArray<int>& c0,
+                               SharedArray<int>& t0,
+                               SharedArray<int>& out0, SharedArray<int>& in0)
+    : Propagator(home), x(x0), s(s0), c(c0), t(t0), out(out0), in(in0) {
+    home.notice(*this,AP_DISPOSE);
+    x.subscribe(home,*this,PC_INT_BND);
+  }
+
+  template<class View>
+  forceinline
+  Difference<View>::Difference(Space& home, Difference<View>& p)
+    : Propagator(home,p), s(p.s), c(p.c), t(p.t), out(p.out), in(p.in) {
+    x.update(home,p.x);
+  }
+
+  template<class View>
+  Actor*
+  Difference<View>::copy(Space& home) {
+    return new (home) Difference<View>(home,*this);
+  }
+
+  template<class View>
+  PropCost
+  Difference<View>::cost(const Space&, const ModEventDelta&) const {
+    return PropCost::linear(PropCost::HI, c.size());
+  }
+
+  template<class View>
+  void
+  Difference<View>::reschedule(Space& home) {
+    x.reschedule(home,*this,PC_INT_BND);
+  }
+
+  template<class View>
+  forceinline size_t
+  Difference<View>::dispose(Space& home) {
+    home.ignore(*this,AP_DISPOSE);
+    x.cancel(home,*this,PC_INT_BND);
+    s.~SharedArray();
+    c.~SharedArray();
+    t.~SharedArray();
+    out.~SharedArray();
+    in.~SharedArray();
+    (void) Propagator::dispose(home);
+    return sizeof(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  Difference<View>::propagate(Space& home, const ModEventDelta&) {
+    int n = x.size();
+    Region r;
+    // Queue of views whose bounds must be propagated
+    int* q = r.alloc<int>(n);
+    bool* iq = r.alloc<bool>(n);
+
+    // Propagate lower bounds along the constraints
+    for (int i=0; i<n; i++) {
+      q[i] = i; iq[i] = true;
+    }
+    for (int h=0, l=n; l > 0; l--) {
+      int u = q[h]; iq[u] = false;
+      if (++h == n) h = 0;
+      for (int j=out[u]; j<out[u+1]; j++) {
+        int e = out[n+1+j], v = t[e];
+        long long int m = static_cast<long long int>(x[u].min()) + c[e];
+        if (m > x[v].min()) {
+          GECODE_ME_CHECK(x[v].gq(home,m));
+          if (!iq[v]) {
+            iq[v] = true; q[(h+l-1) % n] = v; l++;
+          }
+        }
+      }
+    }
+
+    // Propagate upper bounds against the constraints
+    for (int i=0; i<n; i++) {
+      q[i] = i; iq[i] = true;
+    }
+    for (int h=0, l=n; l > 0; l--) {
+      int v = q[h]; iq[v] = false;
+      if (++h == n) h = 0;
+      for (int j=in[v]; j<in[v+1]; j++) {
+        int e = in[n+1+j], u = s[e];
+        long long int m = static_cast<long long int>(x[v].max()) - c[e];
+        if (m < x[u].max()) {
+          GECODE_ME_CHECK(x[u].lq(home,m));
+          if (!iq[u]) {
+            iq[u] = true; q[(h+l-1) % n] = u; l++;
+          }
+        }
+      }
+    }
+
+    // Check whether all constraints are entailed
+    for (int e=0; e<c.size(); e++)
+      if (static_cast<long long int>(x[s[e]].max()) + c[e] > x[t[e]].min())
+        return ES_FIX;
+    return home.ES_SUBSUMED(*this);
+  }
+
+  template<class View>
+  ExecStatus
+  Difference<View>::post(Home home, ViewArray<View>& x,
+                         const IntArgs& s0, const IntArgs& c0,
+                         const IntArgs& t0) {
+    SharedArray<int> s, c, t;
+    int m = 0;
+    {
+      Region r;
+      // Map each view to the index of its first occurrence
+      int n = x.size();
+      int* p = r.alloc<int>(n);
+      {
+        Kernel::ViewOcc<View>* o = r.alloc<Kernel::ViewOcc<View>>(n);
+        for (int i=0; i<n; i++) {
+          o[i].x = x[i]; o[i].i = i;
+        }
+        Support::quicksort<Kernel::ViewOcc<View>>(o,n);
+        for (int i=0, j=0; i<n; i=j) {
+          int f = o[i].i;
+          for (j=i+1; (j<n) && (o[j].x == o[i].x); j++)
+            f = std::min(f,o[j].i);
+          for (int k=i; k<j; k++)
+            p[o[k].i] = f;
+        }
+      }
+      // Eliminate multiple occurrences of the same view
+      int j=0;
+      for (int i=0; i<n; i++)
+        if (p[i] == i) {
+          x[j] = x[i]; p[i] = j++;
+        } else {
+          p[i] = p[p[i]];
+        }
+      x.size(j);
+
+      // Constraints on a single view are either entailed or failed
+      for (int i=0; i<c0.size(); i++)
+        if (p[s0[i]] != p[t0[i]])
+          m++;
+        else if (c0[i] > 0)
+          return ES_FAILED;
+      if (m == 0)
+        return ES_OK;
+
+      s.init(m); c.init(m); t.init(m);
+      for (int i=0, e=0; i<c0.size(); i++)
+        if (p[s0[i]] != p[t0[i]]) {
+          s[e] = p[s0[i]]; c[e] = c0[i]; t[e] = p[t0[i]]; e++;
+        }
+    }
+    int n = x.size();
+
+    // Check for a cycle of positive length
+    {
+      Region r;
+      long long int* d = r.alloc<long long int>(n);
+      for (int i=0; i<n; i++)
+        d[i] = 0;
+      for (int k=0; true; k++) {
+        bool relaxed = false;
+        for (int e=0; e<m; e++)
+          if (d[s[e]] + c[e] > d[t[e]]) {
+            d[t[e]] = d[s[e]] + c[e]; relaxed = true;
+          }
+        if (!relaxed)
+          break;
+        if (k >= n)
+          return ES_FAILED;
+      }
+    }
+
+    // Index constraints by start and by target view
+    SharedArray<int> out(n+1+m), in(n+1+m);
+    for (int i=0; i<=n; i++)
+      out[i] = in[i] = 0;
+    for (int e=0; e<m; e++) {
+      out[s[e]+1]++; in[t[e]+1]++;
+    }
+    for (int i=0; i<n; i++) {
+      out[i+1] += out[i]; in[i+1] += in[i];
+    }
+    {
+      Region r;
+      int* po = r.alloc<int>(n);
+      int* pi = r.alloc<int>(n);
+      for (int i=0; i<n; i++) {
+        po[i] = out[i]; pi[i] = in[i];
+      }
+      for (int e=0; e<m; e++) {
+        out[n+1+po[s[e]]++] = e; in[n+1+pi[t[e]]++] = e;
+      }
+    }
+
+    (void) new (home) Difference<View>(home,x,s,c,t,out,in);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
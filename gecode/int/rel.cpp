@@ -623,6 +623,52 @@ namespace Gecode {
     rel(home,y,irt,x,ipl);
   }
 
+  void
+  rel(Home home, const IntVarArgs& x, int w, IntRelType irt,
+      IntPropLevel ipl) {
+    using namespace Int;
+    if ((w <= 0) || (x.size() % w != 0))
+      throw ArgumentSizeMismatch("Int::rel");
+    GECODE_POST;
+    int m = x.size() / w;
+    if (m <= 1)
+      return;
+    switch (irt) {
+    case IRT_EQ: case IRT_NQ:
+      for (int i=1; i<m; i++) {
+        IntVarArgs y(w), z(w);
+        for (int k=0; k<w; k++) {
+          y[k]=x[(i-1)*w+k]; z[k]=x[i*w+k];
+        }
+        rel(home,y,irt,z,ipl);
+      }
+      break;
+    case IRT_LQ: case IRT_LE: case IRT_GQ: case IRT_GR:
+      {
+        bool strict = (irt == IRT_LE) || (irt == IRT_GR);
+        // Decreasing chains are increasing chains with reversed rows
+        bool reverse = (irt == IRT_GQ) || (irt == IRT_GR);
+        ViewArray<IntView> xv(home,x.size());
+        for (int i=0; i<m; i++)
+          for (int k=0; k<w; k++)
+            xv[i*w+k] = x[(reverse ? m-1-i : i)*w+k];
+        if (m == 2) {
+          ViewArray<IntView> yv(home,w);
+          for (int k=0; k<w; k++)
+            yv[k] = xv[w+k];
+          xv.size(w);
+          GECODE_ES_FAIL((Rel::LexLqLe<IntView,IntView>
+                          ::post(home,xv,yv,strict)));
+        } else {
+          GECODE_ES_FAIL(Rel::LexChain<IntView>::post(home,xv,w,strict));
+        }
+      }
+      break;
+    default:
+      throw UnknownRelation("Int::rel");
+    }
+  }
+
 }
 
 // STATISTICS: int-post
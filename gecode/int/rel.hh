@@ -690,12 +690,64 @@ namespace Gecode { namespace Int { namespace Rel {
     virtual size_t dispose(Space& home);
   };
 
+  /**
+   * \brief Lexical chain propagator
+   *
+   * The views \a x are the rows \f$x_0,\ldots,x_{m-1}\f$ of width
+   * \a w stored one after the other. The propagator enforces
+   * \f$x_0\leq_{lex}x_1\leq_{lex}\cdots\leq_{lex}x_{m-1}\f$ (or the
+   * strict version) as follows, using the idea from:
+   *   Mats Carlsson, Nicolas Beldiceanu, Arc-Consistency for a
+   *   Chain of Lexicographic Ordering Constraints. SICS Technical
+   *   Report T2002:18, SICS, Sweden, 2002.
+   *
+   * For each row, the smallest vector within the bounds of the row that
+   * is lexicographically larger than the smallest vector of the previous
+   * row is computed (and symmetrically the largest vector for the
+   * next row). Each row is then pruned to lie between these two vectors.
+   * In contrast to posting \f$m-1\f$ LexLqLe propagators, bounds
+   * information is passed along the entire chain in a single run.
+   *
+   * Requires \code #include <gecode/int/rel.hh> \endcode
+   * \ingroup FuncIntProp
+   */
+  template<class View>
+  class LexChain : public NaryPropagator<View,PC_INT_BND> {
+  protected:
+    using NaryPropagator<View,PC_INT_BND>::x;
+    /// Width of each row
+    int w;
+    /// Whether the order between rows is strict
+    bool strict;
+    /// Constructor for cloning \a p
+    LexChain(Space& home, LexChain<View>& p);
+    /// Constructor for posting
+    LexChain(Home home, ViewArray<View>& x, int w, bool strict);
+    /// Compute smallest vector in row \a r larger than \a l into \a v
+    bool succ(int r, const int* l, int* v) const;
+    /// Compute largest vector in row \a r smaller than \a u into \a v
+    bool pred(int r, const int* u, int* v) const;
+    /// Prune row \a r to be lexicographically at least \a l
+    ExecStatus gq(Space& home, int r, const int* l);
+    /// Prune row \a r to be lexicographically at most \a u
+    ExecStatus lq(Space& home, int r, const int* u);
+  public:
+    /// Copy propagator during cloning
+    virtual Actor* copy(Space& home);
+    /// Perform propagation
+    virtual ExecStatus propagate(Space& home, const ModEventDelta& med);
+    /// Post propagator for lexical chain of rows of width \a w in \a x
+    static ExecStatus post(Home home, ViewArray<View>& x, int w,
+                           bool strict);
+  };
+
 }}}
 
 #include <gecode/int/rel/eq.hpp>
 #include <gecode/int/rel/nq.hpp>
 #include <gecode/int/rel/lq-le.hpp>
 #include <gecode/int/rel/lex.hpp>
+#include <gecode/int/rel/lex-chain.hpp>
 
 #endif
 
@@ -0,0 +1,182 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Int { namespace Rel {
+
+  /*
+   * Lexical chain propagator
+   */
+  template<class View>
+  forceinline
+  LexChain<View>::LexChain(Home home, ViewArray<View>& x, int w0, bool s)
+    : NaryPropagator<View,PC_INT_BND>(home,x), w(w0), strict(s) {}
+
+  template<class View>
+  forceinline
+  LexChain<View>::LexChain(Space& home, LexChain<View>& p)
+    : NaryPropagator<View,PC_INT_BND>(home,p), w(p.w), strict(p.strict) {}
+
+  template<class View>
+  Actor*
+  LexChain<View>::copy(Space& home) {
+    return new (home) LexChain<View>(home,*this);
+  }
+
+  template<class View>
+  forceinline bool
+  LexChain<View>::succ(int r, const int* l, int* v) const {
+    int o = r*w;
+    // Find first position where l is outside the bounds of the row
+    int p = 0;
+    while ((p < w) && (x[o+p].min() <= l[p]) && (l[p] <= x[o+p].max()))
+      p++;
+    if ((p == w) && !strict) {
+      for (int k=0; k<w; k++)
+        v[k] = l[k];
+      return true;
+    }
+    // Find last position that can be increased while keeping the prefix
+    int q = std::min(p,w-1);
+    while ((q >= 0) && (x[o+q].max() <= l[q]))
+      q--;
+    if (q < 0)
+      return false;
+    for (int k=0; k<q; k++)
+      v[k] = l[k];
+    v[q] = std::max(l[q]+1,x[o+q].min());
+    for (int k=q+1; k<w; k++)
+      v[k] = x[o+k].min();
+    return true;
+  }
+
+  template<class View>
+  forceinline bool
+  LexChain<View>::pred(int r, const int* u, int* v) const {
+    int o = r*w;
+    // Find first position where u is outside the bounds of the row
+    int p = 0;
+    while ((p < w) && (x[o+p].min() <= u[p]) && (u[p] <= x[o+p].max()))
+      p++;
+    if ((p == w) && !strict) {
+      for (int k=0; k<w; k++)
+        v[k] = u[k];
+      return true;
+    }
+    // Find last position that can be decreased while keeping the prefix
+    int q = std::min(p,w-1);
+    while ((q >= 0) && (x[o+q].min() >= u[q]))
+      q--;
+    if (q < 0)
+      return false;
+    for (int k=0; k<q; k++)
+      v[k] = u[k];
+    v[q] = std::min(u[q]-1,x[o+q].max());
+    for (int k=q+1; k<w; k++)
+      v[k] = x[o+k].max();
+    return true;
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  LexChain<View>::gq(Space& home, int r, const int* l) {
+    int o = r*w;
+    for (int k=0; k<w; k++) {
+      GECODE_ME_CHECK(x[o+k].gq(home,l[k]));
+      if ((x[o+k].min() > l[k]) || !x[o+k].assigned())
+        break;
+    }
+    return ES_OK;
+  }
+
+  template<class View>
+  forceinline ExecStatus
+  LexChain<View>::lq(Space& home, int r, const int* u) {
+    int o = r*w;
+    for (int k=0; k<w; k++) {
+      GECODE_ME_CHECK(x[o+k].lq(home,u[k]));
+      if ((x[o+k].max() < u[k]) || !x[o+k].assigned())
+        break;
+    }
+    return ES_OK;
+  }
+
+  template<class View>
+  ExecStatus
+  LexChain<View>::propagate(Space& home, const ModEventDelta&) {
+    int m = x.size() / w;
+    Region re;
+    int* lb = re.alloc<int>(x.size());
+    int* ub = re.alloc<int>(x.size());
+    // Smallest feasible vector for each row, from first to last row
+    for (int k=0; k<w; k++)
+      lb[k] = x[k].min();
+    for (int i=1; i<m; i++)
+      if (!succ(i,lb+(i-1)*w,lb+i*w))
+        return ES_FAILED;
+    // All rows are assigned and the chain is satisfied
+    if (x.assigned())
+      return home.ES_SUBSUMED(*this);
+    // Largest feasible vector for each row, from last to first row
+    for (int k=(m-1)*w; k<m*w; k++)
+      ub[k] = x[k].max();
+    for (int i=m-1; i--; )
+      if (!pred(i,ub+(i+1)*w,ub+i*w))
+        return ES_FAILED;
+    for (int i=0; i<m; i++) {
+      const int* l = lb+i*w; const int* u = ub+i*w;
+      // The feasible vectors of a row must not be empty
+      int k = 0;
+      while ((k < w) && (l[k] == u[k]))
+        k++;
+      if ((k < w) && (l[k] > u[k]))
+        return ES_FAILED;
+      GECODE_ES_CHECK(gq(home,i,l));
+      GECODE_ES_CHECK(lq(home,i,u));
+    }
+    return ES_NOFIX;
+  }
+
+  template<class View>
+  ExecStatus
+  LexChain<View>::post(Home home, ViewArray<View>& x, int w, bool strict) {
+    assert((w > 0) && (x.size() % w == 0));
+    if (x.size() > w)
+      (void) new (home) LexChain<View>(home,x,w,strict);
+    return ES_OK;
+  }
+
+}}}
+
+// STATISTICS: int-prop
@@ -514,9 +514,17 @@ namespace Gecode { namespace Int {
     int idx(void) const;
     /// Order among events
     bool operator <(const Event& e) const;
-    /// Allocate from \a r and initialize event array with tasks \a t
+    /**
+     * \brief Allocate from \a r and initialize event array with tasks \a t
+     *
+     * Returns NULL if no task has a required part. The start and
+     * completion events of a task without required part are omitted
+     * if the task does not overlap with any required part. The events
+     * of the first \a k tasks are never omitted.
+     */
     template<class Task>
-    static Event* events(Region& r, const TaskArray<Task>& t, bool& assigned);
+    static Event* events(Region& r, const TaskArray<Task>& t, bool& assigned,
+                         int k=0);
     /// Allocate from \a r and initialize event array with assigned tasks \a t only
     template<class Task>
     static Event* events(Region& r, const TaskArray<Task>& t);
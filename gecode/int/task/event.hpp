@@ -80,45 +80,96 @@ namespace Gecode { namespace Int {
 
   template<class Task>
   forceinline Event*
-  Event::events(Region& r, const TaskArray<Task>& t, bool& assigned) {
+  Event::events(Region& r, const TaskArray<Task>& t, bool& assigned,
+                int k) {
     Event* e = r.alloc<Event>(4*t.size()+1);
 
-    // Initialize events
+    // Initialize events for required parts
     assigned=true;
-    bool required=false;
 
     int n=0;
     for (int i=0; i<t.size(); i++)
       if (t[i].assigned()) {
         // Only add required part
         if (t[i].pmin() > 0) {
-          required = true;
           e[n++].init(Event::ERT,t[i].lst(),i);
           e[n++].init(Event::LRT,t[i].ect(),i);
         } else if (t[i].pmax() == 0) {
-          required = true;
           e[n++].init(Event::ZRO,t[i].lst(),i);
         }
       } else {
         assigned = false;
-        e[n++].init(Event::EST,t[i].est(),i);
-        e[n++].init(Event::LCT,t[i].lct(),i);
         // Check whether task has required part
         if (t[i].lst() < t[i].ect()) {
-          required = true;
           e[n++].init(Event::ERT,t[i].lst(),i);
           e[n++].init(Event::LRT,t[i].ect(),i);
         }
       }
 
-    if (!required)
+    if (n == 0)
       return NULL;
 
-    // Sort events
+    // Sort events for required parts
     Support::quicksort(e, n);
 
+    // Compute the disjoint intervals covered by required parts
+    int* bs = r.alloc<int>(n);
+    int* be = r.alloc<int>(n);
+    int b = 0;
+    {
+      int a = 0;
+      for (int k=0; k<n; k++)
+        if (e[k].type() == Event::ERT) {
+          if (a++ == 0)
+            bs[b] = e[k].time();
+        } else if (e[k].type() == Event::LRT) {
+          if (--a == 0)
+            be[b++] = e[k].time();
+        }
+      assert(a == 0);
+    }
+
+    /*
+     * Add events for the start and completion of unassigned tasks. A
+     * task without required part that does not overlap with any
+     * required part can not be pruned and its events are omitted,
+     * unless it is among the first k tasks.
+     */
+    int m = n;
+    for (int i=0; i<t.size(); i++)
+      if (!t[i].assigned()) {
+        if ((i >= k) && (t[i].lst() >= t[i].ect())) {
+          // Find first interval that ends after the earliest start time
+          int l=0, h=b;
+          while (l < h) {
+            int k = l + (h-l) / 2;
+            if (be[k] <= t[i].est())
+              l = k+1;
+            else
+              h = k;
+          }
+          if ((l == b) || (bs[l] >= t[i].lct()))
+            continue;
+        }
+        e[m++].init(Event::EST,t[i].est(),i);
+        e[m++].init(Event::LCT,t[i].lct(),i);
+      }
+
+    // Sort added events and merge with events for required parts
+    if (m > n) {
+      Support::quicksort(e+n, m-n);
+      Event* f = r.alloc<Event>(n);
+      for (int k=0; k<n; k++)
+        f[k] = e[k];
+      int i=0, j=n, k=0;
+      while ((i < n) && (j < m))
+        e[k++] = (e[j] < f[i]) ? e[j++] : f[i++];
+      while (i < n)
+        e[k++] = f[i++];
+    }
+
     // Write end marker
-    e[n++].init(Event::END,Limits::infinity,0);
+    e[m++].init(Event::END,Limits::infinity,0);
 
     return e;
   }
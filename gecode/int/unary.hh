@@ -779,6 +779,9 @@ namespace Gecode { namespace Int { namespace Unary {
   /// Propagate by edge-finding
   template<class Task>
   ExecStatus edgefinding(Space& home, TaskArray<Task>& t);
+  /// Propagate by edge-finding with optional tasks
+  template<class OptTask, class PL>
+  ExecStatus edgefinding(Space& home, Propagator& p, TaskArray<OptTask>& t);
 
 
   /**
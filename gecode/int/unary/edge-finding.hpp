@@ -69,6 +69,57 @@ namespace Gecode { namespace Int { namespace Unary {
     return edgefinding(home,b);
   }
 
+  template<class OptTaskView>
+  forceinline ExecStatus
+  edgefinding(Space& home, TaskViewArray<OptTaskView>& t, bool& to_purge) {
+    Region r;
+
+    // Omega contains the mandatory tasks, lambda the optional tasks
+    OmegaLambdaTree<OptTaskView> ol(r,t);
+    for (int i=0; i<t.size(); i++)
+      if (!t[i].mandatory()) {
+        ol.shift(i);
+        if (t[i].excluded())
+          ol.lremove(i);
+      }
+
+    ManTaskViewIter<OptTaskView,STO_LCT,false> q(r,t);
+
+    while (q()) {
+      int j = q.task();
+      if (ol.ect() > t[j].lct())
+        return ES_FAILED;
+      while (!ol.lempty() && (ol.lect() > t[j].lct())) {
+        int i = ol.responsible();
+        if (t[i].mandatory()) {
+          GECODE_ME_CHECK(t[i].est(home,ol.ect()));
+        } else if ((t[i].lct() <= t[j].lct()) || (ol.ect() > t[i].lst())) {
+          // Optional task cannot be scheduled, exclude it
+          GECODE_ME_CHECK(t[i].excluded(home));
+          to_purge = true;
+        }
+        ol.lremove(i);
+      }
+      ol.shift(j);
+      ++q;
+    }
+
+    return ES_OK;
+  }
+
+  template<class OptTask, class PL>
+  ExecStatus
+  edgefinding(Space& home, Propagator& p, TaskArray<OptTask>& t) {
+    bool to_purge = false;
+    TaskViewArray<typename TaskTraits<OptTask>::TaskViewFwd> f(t);
+    GECODE_ES_CHECK(edgefinding(home,f,to_purge));
+    TaskViewArray<typename TaskTraits<OptTask>::TaskViewBwd> b(t);
+    GECODE_ES_CHECK(edgefinding(home,b,to_purge));
+    if (to_purge)
+      return purge<OptTask,PL>(home,p,t);
+    return ES_OK;
+  }
+
 }}}
 
 // STATISTICS: int-prop
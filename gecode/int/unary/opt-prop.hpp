@@ -87,24 +87,7 @@ namespace Gecode { namespace Int { namespace Unary {
     if (PL::advanced) {
       GECODE_ES_CHECK((detectable<OptTask,PL>(home,*this,t)));
       GECODE_ES_CHECK((notfirstnotlast<OptTask,PL>(home,*this,t)));
-
-      // Partition into mandatory and optional activities
-      int n = t.size();
-      int i=0, j=n-1;
-      while (true) {
-        while ((i < n) && t[i].mandatory()) i++;
-        while ((j >= 0) && !t[j].mandatory()) j--;
-        if (i >= j) break;
-        std::swap(t[i],t[j]);
-      }
-
-      if (i > 1) {
-        // Truncate array to only contain mandatory tasks
-        t.size(i);
-        GECODE_ES_CHECK(edgefinding(home,t));
-        // Restore to also include optional tasks
-        t.size(n);
-      }
+      GECODE_ES_CHECK((edgefinding<OptTask,PL>(home,*this,t)));
     }
 
     if (!PL::basic)
@@ -198,6 +198,31 @@ namespace Gecode { namespace Int {
     void lst(RangeList* l);
     /// Size of holes in the domain
     unsigned int holes;
+    /// Value corresponding to the first bit of the membership bitset
+    int _bmin;
+    /**
+     * \brief Membership bitset for small domains with holes
+     *
+     * If not NULL, a bit is set for every value of the domain between
+     * its minimum and maximum. The bitset is created when a domain of
+     * width at most \a bits_width gets holes. Afterwards, values are
+     * cleared as they are removed from the range list. As domains only
+     * shrink, the bitset covers all values between minimum and maximum
+     * once created.
+     */
+    Support::BitSetData* _bits;
+    /// Maximal domain width for which a membership bitset is maintained
+    static const unsigned int bits_width = 1024U;
+    /// Test whether \a n is contained in domain (via membership bitset)
+    bool bits_in(int n) const;
+    /// Clear values from \a l to \a u in membership bitset
+    void bits_clear(int l, int u);
+    /// Clear values from \a l to \a u in membership bitset (if any)
+    void bits_remove(int l, int u);
+    /// Create membership bitset from range list
+    GECODE_INT_EXPORT void bits_init(Space& home);
+    /// Create membership bitset if the domain has become small with holes
+    void bits_sync(Space& home);
 
   protected:
     /// Constructor for cloning \a x
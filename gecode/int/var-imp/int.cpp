@@ -78,6 +78,30 @@ namespace Gecode { namespace Int {
     }
   }
 
+  /*
+   * Membership bitset
+   *
+   */
+
+  void
+  IntVarImp::bits_init(Space& home) {
+    assert(!range() && (_bits == NULL) && (width() <= bits_width));
+    unsigned int w = Support::BitSetData::data(width());
+    _bits = home.alloc<Support::BitSetData>(w);
+    for (unsigned int i=0; i<w; i++)
+      _bits[i].init(true);
+    _bmin = dom.min();
+    // Clear all values in the holes between ranges
+    const RangeList* p = NULL;
+    const RangeList* c = fst();
+    const RangeList* n = c->next(p);
+    while (n != NULL) {
+      bits_clear(c->max()+1,n->min()-1);
+      p=c; c=n; n=c->next(p);
+    }
+  }
+
+
   /*
    * "Standard" tell operations
    *
@@ -302,6 +326,10 @@ namespace Gecode { namespace Int {
         }
       }
     }
+    if (me == ME_INT_DOM) {
+      bits_remove(m,m);
+      bits_sync(home);
+    }
     IntDelta d(m,m);
     return notify(home,me,d);
   }
@@ -315,9 +343,19 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImp::IntVarImp(Space& home, IntVarImp& x)
-    : IntVarImpBase(home,x), dom(x.dom.min(),x.dom.max()) {
+    : IntVarImpBase(home,x), dom(x.dom.min(),x.dom.max()), _bits(NULL) {
     holes = x.holes;
     if (holes) {
+      if (x._bits != NULL) {
+        // Only copy the words covering the current domain
+        const unsigned int bpb = Support::BitSetData::bpb;
+        unsigned int f = static_cast<unsigned int>(dom.min()-x._bmin) / bpb;
+        unsigned int l = static_cast<unsigned int>(dom.max()-x._bmin) / bpb;
+        _bits = home.alloc<Support::BitSetData>(l-f+1);
+        for (unsigned int i=f; i<=l; i++)
+          _bits[i-f] = x._bits[i];
+        _bmin = x._bmin + static_cast<int>(f*bpb);
+      }
       int m = 1;
       // Compute length
       {
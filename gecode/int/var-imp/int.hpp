@@ -186,11 +186,11 @@ namespace Gecode { namespace Int {
 
   forceinline
   IntVarImp::IntVarImp(Space& home, int min, int max)
-    : IntVarImpBase(home), dom(min,max,NULL,NULL), holes(0) {}
+    : IntVarImpBase(home), dom(min,max,NULL,NULL), holes(0), _bits(NULL) {}
 
   forceinline
   IntVarImp::IntVarImp(Space& home, const IntSet& d)
-    : IntVarImpBase(home), dom(d.min(),d.max()) {
+    : IntVarImpBase(home), dom(d.min(),d.max()), _bits(NULL) {
     if (d.ranges() > 1) {
       int n = d.ranges();
       assert(n >= 2);
@@ -209,6 +209,7 @@ namespace Gecode { namespace Int {
       r[n-1].min(d.min(n-1)); r[n-1].max(d.max(n-1));
       r[n-1].prevnext(&r[n-2],NULL);
       holes = h;
+      bits_sync(home);
     } else {
       fst(NULL); holes = 0;
     }
@@ -277,6 +278,48 @@ namespace Gecode { namespace Int {
 
 
 
+  /*
+   * Membership bitset
+   *
+   */
+
+  forceinline bool
+  IntVarImp::bits_in(int n) const {
+    assert((_bits != NULL) && (n >= _bmin));
+    unsigned int i = static_cast<unsigned int>(n - _bmin);
+    return _bits[i / Support::BitSetData::bpb].
+      get(i % Support::BitSetData::bpb);
+  }
+
+  forceinline void
+  IntVarImp::bits_clear(int l, int u) {
+    assert((_bits != NULL) && (_bmin <= l) && (l <= u));
+    const unsigned int bpb = Support::BitSetData::bpb;
+    unsigned int i = static_cast<unsigned int>(l - _bmin);
+    unsigned int j = static_cast<unsigned int>(u - _bmin);
+    if (i / bpb == j / bpb) {
+      _bits[i / bpb].clear(i % bpb, j % bpb);
+    } else {
+      _bits[i / bpb].clear(i % bpb, bpb-1U);
+      for (unsigned int k = i / bpb + 1; k < j / bpb; k++)
+        _bits[k].init(false);
+      _bits[j / bpb].clear(0U, j % bpb);
+    }
+  }
+
+  forceinline void
+  IntVarImp::bits_remove(int l, int u) {
+    if ((_bits != NULL) && (l <= u))
+      bits_clear(l,u);
+  }
+
+  forceinline void
+  IntVarImp::bits_sync(Space& home) {
+    if ((_bits == NULL) && !range() && (width() <= bits_width))
+      bits_init(home);
+  }
+
+
   /*
    * Tests
    *
@@ -286,13 +329,15 @@ namespace Gecode { namespace Int {
   IntVarImp::in(int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(n);
+    return (fst() == NULL) || ((_bits != NULL) ? bits_in(n) : in_full(n));
   }
   forceinline bool
   IntVarImp::in(long long int n) const {
     if ((n < dom.min()) || (n > dom.max()))
       return false;
-    return (fst() == NULL) || in_full(static_cast<int>(n));
+    return (fst() == NULL) ||
+      ((_bits != NULL) ? bits_in(static_cast<int>(n))
+                       : in_full(static_cast<int>(n)));
   }
 
 
@@ -533,6 +578,8 @@ namespace Gecode { namespace Int {
       RangeList*   l = f;
       unsigned int s = static_cast<unsigned int>(max0-min0+1);
       do {
+        // Values between two new ranges are not in the domain
+        bits_remove(l->max()+1,ri.min()-1);
         RangeList* n = new (home) RangeList(ri.min(),ri.max(),l,NULL);
         l->next(NULL,n);
         l = n;
@@ -572,6 +619,7 @@ namespace Gecode { namespace Int {
         if (r->max() < min0) {
           // Entire range removed
           h += r->width();
+          bits_remove(r->min(),r->max());
           RangeList* n=r->next(p);
           p->next(r,n); n->prev(r,p);
           r->dispose(home);
@@ -591,6 +639,7 @@ namespace Gecode { namespace Int {
           assert((r->min() <= min0) && (max0 <= r->max()));
           h += r->width();
           int end = r->max();
+          bits_remove(r->min(),min0-1);
           // Copy first range
           r->min(min0); r->max(max0);
           assert(h > r->width());
@@ -599,13 +648,18 @@ namespace Gecode { namespace Int {
             RangeList* n=r->next(p); p=r; r=n;
           }
           while (true) {
-            if (!ri())
+            if (!ri()) {
+              bits_remove(p->max()+1,end);
               goto done;
+            }
             min0=ri.min(); max0=ri.max(); ++ri;
-            if (max0 > end)
+            if (max0 > end) {
+              bits_remove(p->max()+1,end);
               break;
+            }
             assert(h > static_cast<unsigned int>(max0-min0+1));
             h -= max0-min0+1;
+            bits_remove(p->max()+1,min0-1);
             RangeList* n = new (home) RangeList(min0,max0,p,r);
             p->next(r,n); r->prev(p,n);
             p=n;
@@ -661,6 +715,8 @@ namespace Gecode { namespace Int {
       return ME_INT_NONE;
     }
   notify:
+    if (!range())
+      bits_sync(home);
     IntDelta d;
     return notify(home,me,d);
   }
@@ -739,6 +795,7 @@ namespace Gecode { namespace Int {
       } else if ((i_min <= r->min()) && (r->max() <= i_max)) {
         // r is included in i: remove entire range r
         h += r->width();
+        bits_remove(r->min(),r->max());
         RangeList* n=r->next(p);
         p->next(r,n); n->prev(r,p);
         r->dispose(home);
@@ -748,6 +805,7 @@ namespace Gecode { namespace Int {
       } else if ((i_min > r->min()) && (i_max < r->max())) {
         // i is included in r: create new range before the current one
         h += static_cast<unsigned int>(i_max - i_min) + 1;
+        bits_remove(i_min,i_max);
         RangeList* n = new (home) RangeList(r->min(),i_min-1,p,r);
         r->min(i_max+1);
         p->next(r,n); r->prev(p,n);
@@ -761,6 +819,7 @@ namespace Gecode { namespace Int {
         assert(i_min <= r->min());
         // i ends before r: adjust minimum of r
         h += i_max-r->min()+1;
+        bits_remove(r->min(),i_max);
         r->min(i_max+1);
         if (!i())
           break;
@@ -771,6 +830,7 @@ namespace Gecode { namespace Int {
         assert((i_max >= r->max()) && (r->min() < i_min));
         // r ends before i: adjust maximum of r
         h += r->max()-i_min+1;
+        bits_remove(i_min,r->max());
         r->max(i_min-1);
         RangeList* n=r->next(p); p=r; r=n;
         if (r == &l)
@@ -826,6 +886,8 @@ namespace Gecode { namespace Int {
 
     return ME_INT_NONE;
   notify:
+    if (!range())
+      bits_sync(home);
     IntDelta d;
     return notify(home,me,d);
   }
@@ -900,7 +962,7 @@ namespace Gecode { namespace Int {
       } else {
         if ((v == r->min()) && (v == r->max())) {
           // Remove range
-          h++;
+          h++; bits_remove(v,v);
           RangeList* n=r->next(p);
           p->next(r,n); n->prev(r,p);
           r->dispose(home);
@@ -908,16 +970,16 @@ namespace Gecode { namespace Int {
           if (r == &l)
             break;
         } else if (v == r->min()) {
-          h++; r->min(v+1);
+          h++; bits_remove(v,v); r->min(v+1);
         } else if (v == r->max()) {
-          h++; r->max(v-1);
+          h++; bits_remove(v,v); r->max(v-1);
           RangeList* n=r->next(p); p=r; r=n;
           if (r == &l)
             break;
         } else if (v > r->min()) {
           // Create new range before the current one
           assert(v < r->max());
-          h++;
+          h++; bits_remove(v,v);
           RangeList* n = new (home) RangeList(r->min(),v-1,p,r);
           r->min(v+1);
           p->next(r,n); r->prev(p,n);
@@ -970,11 +1032,13 @@ namespace Gecode { namespace Int {
       assert((dom.min() != fn->min()) || (dom.max() != ln->max()));
       dom.min(fn->min()); dom.max(ln->max());
       holes -= b;
+      bits_sync(home);
       return notify(home,ME_INT_BND,d);
     }
 
     if (h > 0) {
       assert((dom.min() == fn->min()) && (dom.max() == ln->max()));
+      bits_sync(home);
       return notify(home,ME_INT_DOM,d);
     }
 
@@ -53,6 +53,7 @@ namespace Gecode {
 #include <gecode/iter/ranges-append.hpp>
 #include <gecode/iter/ranges-array.hpp>
 #include <gecode/iter/ranges-cache.hpp>
+#include <gecode/iter/ranges-buffer.hpp>
 #include <gecode/iter/ranges-compl.hpp>
 #include <gecode/iter/ranges-diff.hpp>
 #include <gecode/iter/ranges-empty.hpp>
@@ -0,0 +1,192 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <algorithm>
+
+namespace Gecode { namespace Iter { namespace Ranges {
+
+  /**
+   * \brief %Range iterator over a flat buffer of ranges
+   *
+   * The buffer is allocated from a region and is filled either by
+   * copying a range iterator or by evaluating the union, intersection,
+   * or difference of two range iterators in a single merging pass. As
+   * no intermediate iterator objects are constructed, the buffer can be
+   * used instead of a Cache over a composed iterator.
+   *
+   * The ranges can be iterated several times provided the iterator
+   * is %reset by the reset member function.
+   *
+   * \ingroup FuncIterRanges
+   */
+  class Buffer : public Array {
+  protected:
+    /// Region used for allocation
+    Region* reg;
+    /// Number of ranges for which memory is allocated
+    unsigned int cap;
+    /// Append range \a min to \a max, merging adjacent ranges
+    void push(int min, int max);
+  public:
+    /// \name Constructors and initialization
+    //@{
+    /// Initialize as empty buffer allocating from \a r
+    Buffer(Region& r);
+    /// Initialize with ranges from \a i
+    template<class I>
+    Buffer(Region& r, I& i);
+    /// Replace ranges by ranges from \a i
+    template<class I>
+    void init(I& i);
+    //@}
+
+    /// \name Fused operations
+    //@{
+    /// Replace ranges by union of \a i and \a j
+    template<class I, class J>
+    void unite(I& i, J& j);
+    /// Replace ranges by intersection of \a i and \a j
+    template<class I, class J>
+    void inter(I& i, J& j);
+    /// Replace ranges by ranges of \a i not in \a j
+    template<class I, class J>
+    void diff(I& i, J& j);
+    //@}
+
+    /// \name Buffer access
+    //@{
+    /// Return number of ranges
+    unsigned int ranges(void) const;
+    //@}
+  };
+
+
+  forceinline
+  Buffer::Buffer(Region& r0)
+    : Array(NULL,0U), reg(&r0), cap(0U) {}
+
+  forceinline void
+  Buffer::push(int min, int max) {
+    assert(min <= max);
+    if ((n > 0U) && (r[n-1U].max+1 >= min)) {
+      r[n-1U].max = std::max(r[n-1U].max,max);
+      return;
+    }
+    if (n == cap) {
+      unsigned int m = std::max(2U*cap,4U);
+      r = reg->realloc<Range>(r,cap,m);
+      cap = m;
+    }
+    r[n].min = min; r[n].max = max; n++;
+  }
+
+  template<class I>
+  forceinline void
+  Buffer::init(I& i) {
+    c = n = 0U;
+    for (; i(); ++i)
+      push(i.min(),i.max());
+  }
+
+  template<class I>
+  forceinline
+  Buffer::Buffer(Region& r0, I& i)
+    : Array(NULL,0U), reg(&r0), cap(0U) {
+    init(i);
+  }
+
+  template<class I, class J>
+  void
+  Buffer::unite(I& i, J& j) {
+    c = n = 0U;
+    while (i() && j()) {
+      if (i.min() <= j.min()) {
+        push(i.min(),i.max()); ++i;
+      } else {
+        push(j.min(),j.max()); ++j;
+      }
+    }
+    for (; i(); ++i)
+      push(i.min(),i.max());
+    for (; j(); ++j)
+      push(j.min(),j.max());
+  }
+
+  template<class I, class J>
+  void
+  Buffer::inter(I& i, J& j) {
+    c = n = 0U;
+    while (i() && j()) {
+      int min = std::max(i.min(),j.min());
+      int max = std::min(i.max(),j.max());
+      if (min <= max)
+        push(min,max);
+      if (i.max() < j.max())
+        ++i;
+      else
+        ++j;
+    }
+  }
+
+  template<class I, class J>
+  void
+  Buffer::diff(I& i, J& j) {
+    c = n = 0U;
+    while (i()) {
+      int min = i.min();
+      // Skip ranges of j that are entirely before the current range
+      while (j() && (j.max() < min))
+        ++j;
+      // Cut out all ranges of j overlapping with the current range
+      while (j() && (j.min() <= i.max())) {
+        if (min < j.min())
+          push(min,j.min()-1);
+        if (j.max() >= i.max())
+          goto next;
+        min = j.max()+1;
+        ++j;
+      }
+      push(min,i.max());
+    next:
+      ++i;
+    }
+  }
+
+  forceinline unsigned int
+  Buffer::ranges(void) const {
+    return n;
+  }
+
+}}}
+
+// STATISTICS: iter-any
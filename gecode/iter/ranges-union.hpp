@@ -81,6 +81,14 @@ namespace Gecode { namespace Iter { namespace Ranges {
     /// Insert ranges from \a i into \a u
     template<class I>
     void insert(I& i, RangeList*& u);
+    /// Minimal number of iterators for which a tournament tree is used
+    static const int n_tournament = 8;
+    /// Return which of the iterators \a a and \a b in \a i has the smaller minimum
+    template<class I>
+    static int smaller(I* i, int a, int b);
+    /// Return range list for union of the \a n iterators in \a i
+    template<class I>
+    RangeList* tournament(Region& r, I* i, int n);
   public:
     /// \name Constructors and initialization
     //@{
@@ -271,6 +279,56 @@ namespace Gecode { namespace Iter { namespace Ranges {
   }
 
 
+  template<class I>
+  forceinline int
+  NaryUnion::smaller(I* i, int a, int b) {
+    if (a < 0)
+      return b;
+    if (b < 0)
+      return a;
+    return (i[b].min() < i[a].min()) ? b : a;
+  }
+
+  template<class I>
+  RangeListIter::RangeList*
+  NaryUnion::tournament(Region& r, I* i, int n) {
+    // Number of leaves of the tree
+    int s = 1;
+    while (s < n)
+      s <<= 1;
+    // The tree: t[1] is the root, t[s+k] the leaf for iterator k
+    int* t = r.alloc<int>(2*s);
+    for (int k=0; k<s; k++)
+      t[s+k] = ((k < n) && i[k]()) ? k : -1;
+    for (int k=s; --k > 0; )
+      t[k] = smaller(i,t[2*k],t[2*k+1]);
+
+    RangeList*  h;
+    RangeList** c = &h;
+    // The last range created
+    RangeList*  l = NULL;
+    while (t[1] >= 0) {
+      int w = t[1];
+      if ((l != NULL) && (i[w].min() <= l->max+1)) {
+        l->max = std::max(l->max,i[w].max());
+      } else {
+        l = range(i[w]);
+        *c = l; c = &l->next;
+      }
+      ++i[w];
+      // Replay the matches on the path from the leaf to the root
+      int k = s+w;
+      if (!i[w]())
+        t[k] = -1;
+      for (k >>= 1; k > 0; k >>= 1)
+        t[k] = smaller(i,t[2*k],t[2*k+1]);
+    }
+    *c = NULL;
+    r.free<int>(t,2*s);
+    return h;
+  }
+
+
   forceinline
   NaryUnion::NaryUnion(void)
     : f(NULL) {}
@@ -312,6 +370,9 @@ namespace Gecode { namespace Iter { namespace Ranges {
     if (m == n) {
       // Union is just a single iterator
       set(copy(i[m]));
+    } else if (n-m+1 >= n_tournament) {
+      // Many iterators: merge them by a tournament tree
+      set(tournament(r,i+m,n-m+1));
     } else {
       // At least two iterators
       RangeList* u = two(i[m++],i[n--]);
@@ -2600,6 +2600,8 @@ namespace Gecode {
      * The first list element to be retuned is \a f, the last is \a l.
      */
     template<size_t> void  fl_dispose(FreeList* f, FreeList* l);
+    /// Return size (in bytes) of heap chunks allocated by the space
+    size_t allocated(void) const;
     //@}
     /// Construction routines
     //@{
@@ -2803,6 +2805,10 @@ namespace Gecode {
   Space::rfree(void* p, size_t s) {
     return mm.reuse(p,s);
   }
+  forceinline size_t
+  Space::allocated(void) const {
+    return mm.allocated();
+  }
   forceinline void*
   Space::rrealloc(void* _b, size_t n, size_t m) {
     char* b = static_cast<char*>(_b);
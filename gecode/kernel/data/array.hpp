@@ -465,6 +465,19 @@ namespace Gecode {
     /// Test if all variables are assigned
     bool assigned(void) const;
 
+    /**
+     * \brief Restrict domain of view \a i to values greater or equal than \a b[i]
+     *
+     * The array \a b must provide a bound for each view. Views whose
+     * lower bound is already large enough are skipped with a single
+     * comparison, without calling the domain operation.
+     *
+     * Returns ES_FAILED if an update fails, ES_NOFIX if at least one
+     * view has been modified, and ES_FIX otherwise.
+     */
+    template<class Val>
+    ExecStatus gq(Space& home, const Val* b);
+
     /// \name View equality
     //@{
     /**
@@ -1381,6 +1394,21 @@ namespace Gecode {
     return true;
   }
 
+  template<class View>
+  template<class Val>
+  forceinline ExecStatus
+  ViewArray<View>::gq(Space& home, const Val* b) {
+    ExecStatus es = ES_FIX;
+    for (int i=0; i<n; i++)
+      if (b[i] > x[i].min()) {
+        ModEvent me = x[i].gq(home,b[i]);
+        if (me_failed(me))
+          return ES_FAILED;
+        es = ES_NOFIX;
+      }
+    return es;
+  }
+
   template<class View>
   bool
   ViewArray<View>::same(void) const {
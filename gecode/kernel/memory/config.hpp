@@ -132,6 +132,13 @@ namespace Gecode { namespace Kernel {
      * memory will be allocated from the heap.
      */
     const size_t region_area_size = 32 * 1024;
+    /**
+     * \brief Number of region chunks cached by each thread
+     *
+     * Regions are often nested, for example when a propagator and a
+     * function it calls both use a region.
+     */
+    const unsigned int n_region_local = 2;
 
     /// Align size \a s to the required alignment \a a
     void align(size_t& s, size_t a = GECODE_MEMORY_ALIGNMENT);
@@ -35,28 +35,71 @@
 
 namespace Gecode {
 
+  /// Chunks cached by a single thread
+  class Region::Pool::Local {
+  public:
+    /// The cached chunks
+    Chunk* c;
+    /// Number of cached chunks
+    unsigned int n_c;
+    /// Number of chunks obtained from the cache not yet accounted for
+    unsigned long int n_hit;
+    /// Initialize
+    Local(void) : c(nullptr), n_c(0U), n_hit(0UL) {}
+    /// Return cached chunks to the pool
+    ~Local(void) {
+      while (c != nullptr) {
+        Chunk* n = c->next;
+        pool().release(c);
+        c = n;
+      }
+    }
+  };
+
+  Region::Pool::Local&
+  Region::Pool::local(void) {
+    static thread_local Local l;
+    return l;
+  }
+
   Region::Pool::Pool(void)
-    : c(new Chunk), n_c(2U) {
+    : c(new Chunk), n_c(2U), n_hit(0UL), n_miss(0UL) {
     c->next = new Chunk; c->next->next = nullptr;
   }
   Region::Chunk*
   Region::Pool::chunk(void) {
+    Local& l = local();
     Chunk* n;
-    {
-      Support::Lock l(m);
+    if (l.c != nullptr) {
+      assert(l.n_c > 0U);
+      n = l.c; l.c = n->next; l.n_c--;
+      l.n_hit++;
+    } else {
+      Support::Lock lock(m);
+      n_hit += l.n_hit; l.n_hit = 0UL;
+      n_miss++;
       if (c != nullptr) {
         assert(n_c > 0U);
         n = c; c = c->next; n_c--;
       } else {
         n = new Region::Chunk;
       }
-      n->reset();
     }
+    n->reset();
     return n;
   }
   void
   Region::Pool::chunk(Chunk* u) {
-    Support::Lock l(m);
+    Local& l = local();
+    if (l.n_c < Kernel::MemoryConfig::n_region_local) {
+      u->next = l.c; l.c = u; l.n_c++;
+    } else {
+      release(u);
+    }
+  }
+  void
+  Region::Pool::release(Chunk* u) {
+    Support::Lock lock(m);
     if (n_c == Kernel::MemoryConfig::n_hc_cache) {
       delete u;
     } else {
@@ -64,15 +107,21 @@ namespace Gecode {
       n_c++;
     }
   }
+  void
+  Region::Pool::statistics(unsigned long int& hit, unsigned long int& miss) {
+    Local& l = local();
+    Support::Lock lock(m);
+    n_hit += l.n_hit; l.n_hit = 0UL;
+    hit = n_hit; miss = n_miss;
+  }
   Region::Pool::~Pool(void) {
-    Support::Lock l(m);
-    // If that were the case there would be a memory leak!
-    assert(c != nullptr);
-    do {
+    Support::Lock lock(m);
+    // Chunks might still be cached by threads that have not terminated
+    while (c != nullptr) {
       Chunk* n=c->next;
       delete c;
       c=n;
-    } while (c != nullptr);
+    }
   }
 
   Region::Pool& Region::pool(void) {
@@ -80,6 +129,11 @@ namespace Gecode {
     return _p;
   }
 
+  void
+  Region::statistics(unsigned long int& hit, unsigned long int& miss) {
+    pool().statistics(hit,miss);
+  }
+
   void*
   Region::heap_alloc(size_t s) {
     void* p = heap.ralloc(s);
@@ -72,15 +72,32 @@ namespace Gecode {
     };
     /// The heap chunk in use
     Chunk* chunk;
-    /// A pool of heap chunks to be used for regions
+    /**
+     * \brief A pool of heap chunks to be used for regions
+     *
+     * Each thread keeps a small number of chunks that can be obtained
+     * and returned without synchronization. Only if the thread has
+     * no chunk left (or too many chunks) the globally shared chunks
+     * are accessed.
+     */
     class GECODE_KERNEL_EXPORT Pool {
     protected:
+      /// Chunks cached by a single thread
+      class Local;
       /// The current chunk
       Chunk* c;
       /// Number of cached chunks
       unsigned int n_c;
+      /// Number of chunks obtained from the thread-local chunks
+      unsigned long int n_hit;
+      /// Number of chunks obtained from the globally shared chunks
+      unsigned long int n_miss;
       /// Mutex to synchronize globally shared access
       Support::Mutex m;
+      /// Return chunks cached by the current thread
+      static Local& local(void);
+      /// Return chunk \a u to the globally shared chunks
+      void release(Chunk* u);
     public:
       /// Initialize pool
       Pool(void);
@@ -88,6 +105,8 @@ namespace Gecode {
       Chunk* chunk(void);
       /// Return chunk and possible free unused chunk \a u
       void chunk(Chunk* u);
+      /// Return number of chunks obtained without and with synchronization
+      void statistics(unsigned long int& hit, unsigned long int& miss);
       /// Delete pool
       ~Pool(void);
     };
@@ -118,6 +137,17 @@ namespace Gecode {
   public:
     /// Initialize region
     Region(void);
+    /**
+     * \brief Return statistics for the chunks used by regions
+     *
+     * The number \a hit is the number of regions that could use a
+     * chunk cached by the current thread, the number \a miss is the
+     * number of regions that had to access the globally shared chunks.
+     * Hits of a thread are accounted for only when the thread
+     * accesses the shared chunks, hence \a hit is approximate.
+     */
+    GECODE_KERNEL_EXPORT
+    static void statistics(unsigned long int& hit, unsigned long int& miss);
     /**
      * \brief Free allocate memory
      *
@@ -2304,6 +2304,38 @@ namespace Gecode {
   void element(Home home, const Matrix<SetVarArgs>& m, IntVar x, IntVar y,
                SetVar z);
 #endif
+  /** \brief Post relation \a irt between consecutive rows of \a m
+   *
+   * For the inequality relations this posts a single propagator for
+   * the chain of lexical orders between the rows.
+   * \relates Gecode::Matrix
+   */
+  void rows_lex(Home home, const Matrix<IntVarArgs>& m, IntRelType irt,
+                IntPropLevel ipl=IPL_DEF);
+  /** \brief Post relation \a irt between consecutive rows of \a m
+   *
+   * For the inequality relations this posts a single propagator for
+   * the chain of lexical orders between the rows.
+   * \relates Gecode::Matrix
+   */
+  void rows_lex(Home home, const Matrix<BoolVarArgs>& m, IntRelType irt,
+                IntPropLevel ipl=IPL_DEF);
+  /** \brief Post relation \a irt between consecutive columns of \a m
+   *
+   * For the inequality relations this posts a single propagator for
+   * the chain of lexical orders between the columns.
+   * \relates Gecode::Matrix
+   */
+  void columns_lex(Home home, const Matrix<IntVarArgs>& m, IntRelType irt,
+                   IntPropLevel ipl=IPL_DEF);
+  /** \brief Post relation \a irt between consecutive columns of \a m
+   *
+   * For the inequality relations this posts a single propagator for
+   * the chain of lexical orders between the columns.
+   * \relates Gecode::Matrix
+   */
+  void columns_lex(Home home, const Matrix<BoolVarArgs>& m, IntRelType irt,
+                   IntPropLevel ipl=IPL_DEF);
 
   /** \brief Interchangeable rows symmetry specification.
    * \relates Gecode::Matrix
@@ -238,6 +238,36 @@ namespace Gecode {
   }
 #endif
 
+  forceinline void
+  rows_lex(Home home, const Matrix<IntVarArgs>& m, IntRelType irt,
+           IntPropLevel ipl) {
+    rel(home, m.get_array(), m.width(), irt, ipl);
+  }
+  forceinline void
+  columns_lex(Home home, const Matrix<IntVarArgs>& m, IntRelType irt,
+              IntPropLevel ipl) {
+    IntVarArgs x(m.width()*m.height());
+    for (int c=0; c<m.width(); c++)
+      for (int r=0; r<m.height(); r++)
+        x[c*m.height()+r] = m(c,r);
+    rel(home, x, m.height(), irt, ipl);
+  }
+
+  forceinline void
+  rows_lex(Home home, const Matrix<BoolVarArgs>& m, IntRelType irt,
+           IntPropLevel ipl) {
+    rel(home, m.get_array(), m.width(), irt, ipl);
+  }
+  forceinline void
+  columns_lex(Home home, const Matrix<BoolVarArgs>& m, IntRelType irt,
+              IntPropLevel ipl) {
+    BoolVarArgs x(m.width()*m.height());
+    for (int c=0; c<m.width(); c++)
+      for (int r=0; r<m.height(); r++)
+        x[c*m.height()+r] = m(c,r);
+    rel(home, x, m.height(), irt, ipl);
+  }
+
 }
 
 // STATISTICS: minimodel-any
@@ -130,6 +130,9 @@ namespace Gecode { namespace Search {
     /// Depth limit for no-good generation during search
     const unsigned int nogoods_limit = 128;
 
+    /// Memory budget in bytes for clones on the search path (0 for none)
+    const size_t mem_limit = 0;
+
     /// Default port for CPProfiler
     const unsigned int cpprofiler_port = 6565U;
   }
@@ -152,6 +155,8 @@ namespace Gecode { namespace Search {
     unsigned long int node;
     /// Maximum depth of search stack
     unsigned long int depth;
+    /// Peak memory (in bytes) of clones stored on search stack
+    size_t memory;
     /// Number of restarts
     unsigned long int restart;
     /// Number of no-goods posted
@@ -705,6 +710,7 @@ namespace Gecode { namespace Search {
 namespace Gecode { namespace Search {
 
     class Stop;
+    class Visitor;
 
     /**
      * \brief %Search engine options
@@ -724,6 +730,12 @@ namespace Gecode { namespace Search {
      *    is created (approximately in the middle of the path) to speed up
      *    future recomputation. Note that small values of \a a_d can increase
      *    the memory consumption considerably.
+     *  - \a mem_limit as memory budget: if the clones stored on the
+     *    search path exceed \a mem_limit bytes, no further clones are
+     *    created and intermediate clones are dropped. This increases
+     *    the recomputation distance instead of exhausting memory. The
+     *    budget is only honored by sequential depth-first and
+     *    branch-and-bound engines (a value of zero means no budget).
      *
      * Full copying corresponds to a maximal recomputation distance
      * \a c_d of 1.
@@ -761,12 +773,16 @@ namespace Gecode { namespace Search {
       unsigned int slice;
       /// Depth limit for extraction of no-goods
       unsigned int nogoods_limit;
+      /// Memory budget in bytes for clones on the search path (0 for none)
+      size_t mem_limit;
       /// Stop object for stopping search
       Stop* stop;
       /// Cutoff for restart-based search
       Cutoff* cutoff;
       /// Tracer object for tracing search
       SearchTracer* tracer;
+      /// Visitor for solutions (DFS and BAB only, solutions are not returned)
+      Visitor* visitor;
       /// Default options
       GECODE_SEARCH_EXPORT static const Options def;
       /// Initialize with default values
@@ -891,6 +907,62 @@ namespace Gecode { namespace Search {
 
 #include <gecode/search/stop.hpp>
 
+namespace Gecode { namespace Search {
+
+  /**
+   * \defgroup TaskModelSearchVisitor Visitors for solutions
+   * \ingroup TaskModelSearch
+   *
+   * If the search options define a visitor, a search engine passes
+   * each solution to the visitor while the engine still owns it.
+   * The solutions are not returned by the engine: it returns only
+   * after search has been exhausted or has been stopped. As the
+   * solutions are not handed out, parallel engines need not clone
+   * them. Parallel engines call the visitor from different threads,
+   * but never from more than one thread at a time.
+   *
+   * A branch-and-bound search engine passes each better solution to
+   * the visitor. Visitors are supported by depth-first and
+   * branch-and-bound search engines that are not part of a portfolio
+   * or of restart-based search. All other engines throw an exception
+   * of type Search::NoVisitor if a visitor is given.
+   */
+
+  /**
+   * \brief Base-class for visitors of solutions
+   * \ingroup TaskModelSearchVisitor
+   */
+  class GECODE_SEARCH_EXPORT Visitor : public HeapAllocated {
+  public:
+    /// Default constructor
+    Visitor(void);
+    /// Visit solution \a s
+    virtual void solution(const Space& s) = 0;
+    /// Destructor
+    virtual ~Visitor(void);
+  };
+
+  /**
+   * \brief %Visitor that counts solutions
+   * \ingroup TaskModelSearchVisitor
+   */
+  class GECODE_SEARCH_EXPORT CountVisitor : public Visitor {
+  protected:
+    /// Number of solutions
+    unsigned long int n;
+  public:
+    /// Initialize with no solutions
+    CountVisitor(void);
+    /// Count solution \a s
+    virtual void solution(const Space& s);
+    /// Return number of solutions
+    unsigned long int solutions(void) const;
+  };
+
+}}
+
+#include <gecode/search/visitor.hpp>
+
 namespace Gecode { namespace Search {
 
   /**
@@ -1128,6 +1200,57 @@ namespace Gecode {
 
 #include <gecode/search/lds.hpp>
 
+namespace Gecode {
+
+  /**
+   * \brief Best-first search engine
+   *
+   * The engine explores the open node with the smallest lower bound
+   * on the cost first, where the bound of a node is the minimum of
+   * the cost of its parent node after propagation. Subclass \a T of
+   * space must implement a member function \code cost() \endcode
+   * returning the variable to be minimized (as done by
+   * IntMinimizeSpace and FloatMinimizeSpace) and a member function
+   * \code virtual void constrain(const T& t) \endcode as required
+   * by branch-and-bound search. As the cost is always minimized,
+   * using a subclass of IntMaximizeSpace or FloatMaximizeSpace is
+   * rejected at compile time. Every solution returned is better than
+   * the previous one, the last solution is optimal.
+   *
+   * Open nodes are stored as archived paths from the root node and
+   * are recomputed when being explored. The engine is sequential and
+   * ignores the number of threads and the tracer in the options.
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  class BFS : public Search::Base<T> {
+  public:
+    /// Initialize engine for space \a s and options \a o
+    BFS(T* s, const Search::Options& o=Search::Options::def);
+    /// Whether engine does best solution search
+    static const bool best = true;
+  };
+
+  /**
+   * \brief Perform best-first search for subclass \a T of space \a s and options \a o
+   *
+   * Returns the best solution (NULL, if none exists or search has
+   * been stopped).
+   *
+   * \ingroup TaskModelSearch
+   */
+  template<class T>
+  T* bfs(T* s, const Search::Options& o=Search::Options::def);
+
+  /// Return a best-first search engine builder
+  template<class T>
+  SEB bfs(const Search::Options& o=Search::Options::def);
+
+}
+
+#include <gecode/search/bfs.hpp>
+
 namespace Gecode {
 
   /**
@@ -0,0 +1,109 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <type_traits>
+
+namespace Gecode {
+
+  class IntMaximizeSpace;
+  class FloatMaximizeSpace;
+
+}
+
+namespace Gecode { namespace Search {
+
+  /// Create best-first search engine
+  GECODE_SEARCH_EXPORT Engine*
+  bfsengine(Space* s, double (*b)(const Space&), const Options& o);
+
+  /// Return lower bound on the cost of space \a s of type \a T
+  template<class T>
+  double
+  bfsbound(const Space& s) {
+    static_assert(!std::is_base_of<IntMaximizeSpace,T>::value &&
+                  !std::is_base_of<FloatMaximizeSpace,T>::value,
+                  "Best-first search requires a cost to be minimized");
+    return static_cast<double>(static_cast<const T&>(s).cost().min());
+  }
+
+  /// A best-first search engine builder
+  template<class T>
+  class BfsBuilder : public Builder {
+    using Builder::opt;
+  public:
+    /// The constructor
+    BfsBuilder(const Options& opt);
+    /// The actual build function
+    virtual Engine* operator() (Space* s) const;
+  };
+
+  template<class T>
+  inline
+  BfsBuilder<T>::BfsBuilder(const Options& opt)
+    : Builder(opt,BFS<T>::best) {}
+
+  template<class T>
+  Engine*
+  BfsBuilder<T>::operator() (Space* s) const {
+    return build<T,BFS>(s,opt);
+  }
+
+}}
+
+namespace Gecode {
+
+  template<class T>
+  forceinline
+  BFS<T>::BFS(T* s, const Search::Options& o)
+    : Search::Base<T>(Search::bfsengine(s,&Search::bfsbound<T>,o)) {}
+
+  template<class T>
+  T*
+  bfs(T* s, const Search::Options& o) {
+    BFS<T> bfs(s,o);
+    T* l = NULL;
+    while (T* n = bfs.next()) {
+      delete l; l = n;
+    }
+    return l;
+  }
+
+  template<class T>
+  SEB
+  bfs(const Search::Options& o) {
+    return new Search::BfsBuilder<T>(o);
+  }
+
+}
+
+// STATISTICS: search-other
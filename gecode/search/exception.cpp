@@ -48,6 +48,9 @@ namespace Gecode { namespace Search {
   NoBest::NoBest(const char* l)
     : Exception(l,"Best solution search is not supported") {}
 
+  NoVisitor::NoVisitor(const char* l)
+    : Exception(l,"Visitors for solutions are not supported") {}
+
 }}
 
 // STATISTICS: search-other
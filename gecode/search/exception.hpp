@@ -62,6 +62,12 @@ namespace Gecode { namespace Search {
     /// Initialize with location \a l
     NoBest(const char* l);
   };
+  /// %Exception: Visitors for solutions are not supported
+  class GECODE_SEARCH_EXPORT NoVisitor : public Exception {
+  public:
+    /// Initialize with location \a l
+    NoVisitor(const char* l);
+  };
   //@}
 }}
 
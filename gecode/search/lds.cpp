@@ -43,6 +43,8 @@ namespace Gecode { namespace Search {
 
   Engine*
   ldsengine(Space* s, const Options& o) {
+    if (o.visitor != NULL)
+      throw NoVisitor("LDS::LDS");
     if (o.tracer)
       return new Seq::LDS<EdgeTraceRecorder>(s,o);
     else
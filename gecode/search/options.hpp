@@ -40,7 +40,9 @@ namespace Gecode { namespace Search {
       c_d(Config::c_d), a_d(Config::a_d),
       d_l(Config::d_l),
       assets(0), slice(Config::slice), nogoods_limit(0),
-      stop(nullptr), cutoff(nullptr), tracer(nullptr) {}
+      mem_limit(Config::mem_limit),
+      stop(nullptr), cutoff(nullptr), tracer(nullptr),
+      visitor(nullptr) {}
 
 }}
 
@@ -38,6 +38,33 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /**
+   * \brief Best solution shared by an engine and its workers
+   *
+   * The solution is only read after creation (by constraining spaces
+   * to be better), hence all workers can use the same solution instead
+   * of a clone each. The solution is deleted when the last reference
+   * is released.
+   */
+  class SharedBest {
+  protected:
+    /// The solution
+    Space* s;
+    /// Number of references
+    Support::RefCount rc;
+    /// Delete solution
+    ~SharedBest(void);
+  public:
+    /// Initialize with solution \a s and a single reference
+    SharedBest(Space* s);
+    /// Return solution
+    const Space& space(void) const;
+    /// Add a reference and return this
+    SharedBest* ref(void);
+    /// Release a reference (delete if last)
+    void unref(void);
+  };
+
   /// %Parallel branch-and-bound engine
   template<class Tracer>
   class BAB : public Engine<Tracer> {
@@ -79,7 +106,7 @@ namespace Gecode { namespace Search { namespace Par {
       /// Number of entries not yet constrained to be better
       int mark;
       /// Best solution found so far
-      Space* best;
+      SharedBest* best;
     public:
       /// Initialize for space \a s with engine \a e
       Worker(Space* s, BAB& e);
@@ -88,7 +115,7 @@ namespace Gecode { namespace Search { namespace Par {
       /// Start execution of worker
       virtual void run(void);
       /// Accept better solution \a b
-      void better(Space* b);
+      void better(SharedBest* b);
       /// Try to find some work
       void find(void);
       /// Reset engine to restart at space \a s
@@ -99,7 +126,7 @@ namespace Gecode { namespace Search { namespace Par {
     /// Array of worker references
     Worker** _worker;
     /// Best solution so far
-    Space* best;
+    SharedBest* best;
   public:
     /// Provide access to worker \a i
     Worker* worker(unsigned int i) const;
@@ -108,6 +135,8 @@ namespace Gecode { namespace Search { namespace Par {
     //@{
     /// Report solution \a s
     void solution(Space* s);
+    /// Pass solution \a s to the visitor and make it the best solution
+    void visit(Space* s);
     //@}
 
     /// \name Engine interface
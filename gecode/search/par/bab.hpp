@@ -33,6 +33,32 @@
 
 namespace Gecode { namespace Search { namespace Par {
 
+  /*
+   * Shared best solution
+   */
+  forceinline
+  SharedBest::SharedBest(Space* s0)
+    : s(s0), rc(1U) {}
+  forceinline
+  SharedBest::~SharedBest(void) {
+    delete s;
+  }
+  forceinline const Space&
+  SharedBest::space(void) const {
+    return *s;
+  }
+  forceinline SharedBest*
+  SharedBest::ref(void) {
+    rc.inc();
+    return this;
+  }
+  forceinline void
+  SharedBest::unref(void) {
+    if (rc.dec())
+      delete this;
+  }
+
+
   /*
    * Engine: basic access routines
    */
@@ -52,7 +78,8 @@ namespace Gecode { namespace Search { namespace Par {
   BAB<Tracer>::Worker::reset(Space* s, unsigned int ngdl) {
     tracer.round();
     delete cur;
-    delete best;
+    if (best != NULL)
+      best->unref();
     best = NULL;
     path.reset((s == NULL) ? 0 : ngdl);
     d = 0;
@@ -103,32 +130,51 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline void
-  BAB<Tracer>::Worker::better(Space* b) {
+  BAB<Tracer>::Worker::better(SharedBest* b) {
     m.acquire();
-    delete best;
-    best = b->clone();
+    if (best != NULL)
+      best->unref();
+    best = b->ref();
     mark = path.entries();
     if (cur != NULL)
-      cur->constrain(*best);
+      cur->constrain(best->space());
     m.release();
   }
   template<class Tracer>
   forceinline void
+  BAB<Tracer>::visit(Space* s) {
+    m_search.acquire();
+    if (best != NULL) {
+      s->constrain(best->space());
+      if (s->status() == SS_FAILED) {
+        delete s;
+        m_search.release();
+        return;
+      }
+      best->unref();
+    }
+    opt().visitor->solution(*s);
+    // The visited solution is not handed out and can be shared
+    best = new SharedBest(s);
+    // Announce better solutions
+    for (unsigned int i=0U; i<workers(); i++)
+      worker(i)->better(best);
+    m_search.release();
+  }
+  template<class Tracer>
+  forceinline void
   BAB<Tracer>::solution(Space* s) {
     m_search.acquire();
     if (best != NULL) {
-      s->constrain(*best);
+      s->constrain(best->space());
       if (s->status() == SS_FAILED) {
         delete s;
         m_search.release();
         return;
-      } else {
-        delete best;
-        best = s->clone();
       }
-    } else {
-      best = s->clone();
+      best->unref();
     }
+    best = new SharedBest(s->clone());
     // Announce better solutions
     for (unsigned int i=0U; i<workers(); i++)
       worker(i)->better(best);
@@ -160,7 +206,7 @@ namespace Gecode { namespace Search { namespace Par {
         cur = s;
         mark = 0;
         if (best != NULL)
-          cur->constrain(*best);
+          cur->constrain(best->space());
         Statistics t = *this;
         Search::Worker::reset(r_d);
         (*this) += t;
@@ -186,15 +232,18 @@ namespace Gecode { namespace Search { namespace Par {
   void
   BAB<Tracer>::constrain(const Space& b) {
     m_search.acquire();
+    // The best solution is shared and must not be modified
+    Space* c = b.clone();
     if (best != NULL) {
-      best->constrain(b);
-      if (best->status() != SS_FAILED) {
+      c->constrain(best->space());
+      if (c->status() == SS_FAILED) {
+        delete c;
         m_search.release();
         return;
       }
-      delete best;
+      best->unref();
     }
-    best = b.clone();
+    best = new SharedBest(c);
     // Announce better solutions
     for (unsigned int i=0U; i<workers(); i++)
       worker(i)->better(best);
@@ -298,6 +347,15 @@ namespace Gecode { namespace Search { namespace Par {
                   }
                   // Deletes all pending branchers
                   (void) cur->choice();
+                  if (engine().opt().visitor != NULL) {
+                    // Visit solution without cloning it
+                    Space* s = cur;
+                    cur = NULL;
+                    path.next();
+                    m.release();
+                    engine().visit(s);
+                    break;
+                  }
                   Space* s = cur->clone();
                   delete cur;
                   cur = NULL;
@@ -331,7 +389,11 @@ namespace Gecode { namespace Search { namespace Par {
               }
             }
           } else if (!path.empty()) {
-            cur = path.recompute(d,engine().opt().a_d,*this,*best,mark,tracer);
+            if (best != NULL)
+              cur = path.recompute(d,engine().opt().a_d,*this,
+                                   best->space(),mark,tracer);
+            else
+              cur = path.recompute(d,engine().opt().a_d,*this,tracer);
             if (cur == NULL)
               path.next();
             m.release();
@@ -365,7 +427,8 @@ namespace Gecode { namespace Search { namespace Par {
     // Wait for reset cycle started
     e_reset_ack_start.wait();
     // All workers are marked as busy again
-    delete best;
+    if (best != NULL)
+      best->unref();
     best = NULL;
     n_busy = workers();
     for (unsigned int i=1U; i<workers(); i++)
@@ -409,13 +472,15 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   BAB<Tracer>::Worker::~Worker(void) {
-    delete best;
+    if (best != NULL)
+      best->unref();
   }
 
   template<class Tracer>
   BAB<Tracer>::~BAB(void) {
     terminate();
-    delete best;
+    if (best != NULL)
+      best->unref();
     heap.rfree(_worker);
   }
 
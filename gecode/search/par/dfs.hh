@@ -97,6 +97,8 @@ namespace Gecode { namespace Search { namespace Par {
     //@{
     /// Report solution \a s
     void solution(Space* s);
+    /// Pass solution \a s to the visitor
+    void visit(const Space& s);
     //@}
 
     /// \name Engine interface
@@ -103,6 +103,13 @@ namespace Gecode { namespace Search { namespace Par {
    */
   template<class Tracer>
   forceinline void
+  DFS<Tracer>::visit(const Space& s) {
+    m_search.acquire();
+    opt().visitor->solution(s);
+    m_search.release();
+  }
+  template<class Tracer>
+  forceinline void
   DFS<Tracer>::solution(Space* s) {
     m_search.acquire();
     bool bs = signal();
@@ -246,6 +253,16 @@ namespace Gecode { namespace Search { namespace Par {
                   }
                   // Deletes all pending branchers
                   (void) cur->choice();
+                  if (engine().opt().visitor != NULL) {
+                    // Visit solution without cloning it
+                    Space* s = cur;
+                    cur = NULL;
+                    path.next();
+                    m.release();
+                    engine().visit(*s);
+                    delete s;
+                    break;
+                  }
                   Space* s = cur->clone();
                   delete cur;
                   cur = NULL;
@@ -224,6 +224,9 @@ namespace Gecode {
     if (opt.assets == 0)
       throw Search::NoAssets("PBS::PBS");
 
+    if (opt.visitor != NULL)
+      throw Search::NoVisitor("PBS::PBS");
+
     Search::Statistics stat;
 
     if (s->status(stat) == SS_FAILED) {
@@ -271,6 +274,12 @@ namespace Gecode {
       best = (b == sebs.size());
     }
 
+    if (o.visitor != NULL)
+      throw Search::NoVisitor("PBS::PBS");
+    for (int i=0; i<sebs.size(); i++)
+      if (sebs[i]->options().visitor != NULL)
+        throw Search::NoVisitor("PBS::PBS");
+
     Search::Options opt(o.expand());
     Search::Statistics stat;
 
@@ -83,6 +83,8 @@ namespace Gecode {
   RBS<T,E>::RBS(T* s, const Search::Options& m_opt) {
     if (m_opt.cutoff == NULL)
       throw Search::UninitializedCutoff("RBS::RBS");
+    if (m_opt.visitor != NULL)
+      throw Search::NoVisitor("RBS::RBS");
     Search::Options e_opt(m_opt.expand());
     Search::Statistics stat;
     e_opt.clone = false;
@@ -118,6 +120,8 @@ namespace Gecode {
   rbs(const Search::Options& o) {
     if (o.cutoff == NULL)
       throw Search::UninitializedCutoff("rbs");
+    if (o.visitor != NULL)
+      throw Search::NoVisitor("rbs");
     return new Search::RbsBuilder<T,E>(o);
   }
 
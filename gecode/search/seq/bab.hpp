@@ -40,8 +40,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   BAB<Tracer>::BAB(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0), mark(0), 
-      best(NULL) {
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit,opt.mem_limit),
+      d(0), mark(0), best(NULL) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::BAB, 1U);
       tracer.worker();
@@ -121,12 +121,17 @@ namespace Gecode { namespace Search { namespace Seq {
           cur = NULL;
           path.next();
           mark = path.entries();
+          if (opt.visitor != NULL) {
+            // Visit solution in place and continue
+            opt.visitor->solution(*best);
+            break;
+          }
         }
         return best->clone();
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
+          if ((d == 0) || ((d >= opt.c_d) && !path.full())) {
             c = cur->clone();
             d = 1;
           } else {
@@ -0,0 +1,262 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/search/seq/bfs.hh>
+
+#include <limits>
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  /*
+   * Open nodes
+   *
+   */
+  forceinline
+  BFS::Node::Node(double b, unsigned long int n0, unsigned int d,
+                  const Archive& p)
+    : bound(b), n(n0), depth(d), path(p) {}
+
+  forceinline bool
+  BFS::Node::before(const Node& m) const {
+    return (bound < m.bound) || ((bound == m.bound) && (n > m.n));
+  }
+
+
+  /*
+   * Priority queue of open nodes
+   *
+   */
+  void
+  BFS::open(double b, const Archive& c, unsigned int a) {
+    Node* o = new Node(b,n_nodes++,depth+1,c);
+    o->path << a;
+    // Sift up
+    int i = n_pq++;
+    while (i > 0) {
+      int p = (i-1) >> 1;
+      if (!o->before(*pq[p]))
+        break;
+      pq[i] = pq[p]; i = p;
+    }
+    pq[i] = o;
+  }
+
+  BFS::Node*
+  BFS::close(void) {
+    assert(n_pq > 0);
+    Node* t = pq[0];
+    Node* o = pq[--n_pq];
+    // Sift down
+    int i = 0;
+    while (true) {
+      int c = 2*i+1;
+      if (c >= n_pq)
+        break;
+      if ((c+1 < n_pq) && pq[c+1]->before(*pq[c]))
+        c++;
+      if (!pq[c]->before(*o))
+        break;
+      pq[i] = pq[c]; i = c;
+    }
+    pq[i] = o;
+    return t;
+  }
+
+  void
+  BFS::flush(void) {
+    for (int i=0; i<n_pq; i++)
+      delete pq[i];
+    n_pq = 0;
+  }
+
+  void
+  BFS::prune(void) {
+    bb = lb(*best);
+    // All open nodes have a bound that is not smaller than the first
+    if ((n_pq > 0) && (pq[0]->bound >= bb))
+      flush();
+  }
+
+  Space*
+  BFS::recompute(Node& o) {
+    Space* s = root->clone();
+    for (unsigned int i=0; (i<o.depth) && !s->failed(); i++) {
+      const Choice* c = s->choice(o.path);
+      unsigned int a; o.path >> a;
+      s->commit(*c,a);
+      delete c;
+    }
+    if (best != NULL)
+      s->constrain(*best);
+    path = o.path; depth = o.depth;
+    w.stack_depth(depth);
+    return s;
+  }
+
+
+  /*
+   * The engine
+   *
+   */
+  BFS::BFS(Space* s, double (*b)(const Space&), const Options& o)
+    : opt(o), lb(b), root(NULL), cur(NULL), depth(0), best(NULL),
+      bb(std::numeric_limits<double>::infinity()),
+      pq(heap), n_pq(0), n_nodes(0) {
+    if ((s == NULL) || (s->status(w) == SS_FAILED)) {
+      w.fail++;
+      if (!opt.clone)
+        delete s;
+    } else {
+      root = snapshot(s,opt);
+      cur = root->clone();
+    }
+  }
+
+  Space*
+  BFS::next(void) {
+    w.start();
+    while (true) {
+      if (w.stop(opt))
+        return NULL;
+      while (cur == NULL) {
+        if (n_pq == 0)
+          return NULL;
+        Node* o = close();
+        if (o->bound < bb)
+          cur = recompute(*o);
+        else
+          // The node cannot lead to a better solution, nor can all others
+          flush();
+        delete o;
+      }
+      w.node++;
+      switch (cur->status(w)) {
+      case SS_FAILED:
+        w.fail++;
+        delete cur;
+        cur = NULL;
+        break;
+      case SS_SOLVED:
+        // Deletes all pending branchers
+        (void) cur->choice();
+        delete best;
+        best = cur;
+        cur = NULL;
+        prune();
+        return best->clone();
+      case SS_BRANCH:
+        {
+          double b = lb(*cur);
+          const Choice* ch = cur->choice();
+          Archive c(path);
+          ch->archive(c);
+          for (unsigned int a=1; a<ch->alternatives(); a++)
+            open(b,c,a);
+          if ((n_pq > 0) && (pq[0]->bound < b)) {
+            // A better open node exists, continue with it
+            open(b,c,0U);
+            delete cur;
+            cur = NULL;
+          } else {
+            cur->commit(*ch,0);
+            path = c; path << 0U;
+            w.stack_depth(++depth);
+          }
+          delete ch;
+          break;
+        }
+      default:
+        GECODE_NEVER;
+      }
+    }
+    GECODE_NEVER;
+    return NULL;
+  }
+
+  Statistics
+  BFS::statistics(void) const {
+    return w;
+  }
+
+  bool
+  BFS::stopped(void) const {
+    return w.stopped();
+  }
+
+  void
+  BFS::constrain(const Space& b) {
+    if (best != NULL) {
+      // Check whether b is in fact better than best
+      best->constrain(b);
+      if (best->status(w) != SS_FAILED)
+        return;
+      else
+        delete best;
+    }
+    best = b.clone();
+    if (cur != NULL)
+      cur->constrain(b);
+    prune();
+  }
+
+  void
+  BFS::reset(Space* s) {
+    flush();
+    delete best;
+    best = NULL;
+    bb = std::numeric_limits<double>::infinity();
+    delete cur;
+    cur = NULL;
+    delete root;
+    root = NULL;
+    path = Archive();
+    depth = 0;
+    if ((s == NULL) || (s->status(w) == SS_FAILED)) {
+      delete s;
+    } else {
+      root = s;
+      cur = root->clone();
+    }
+    w.reset();
+  }
+
+  BFS::~BFS(void) {
+    flush();
+    delete best;
+    delete cur;
+    delete root;
+  }
+
+}}}
+
+// STATISTICS: search-seq
@@ -0,0 +1,130 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#ifndef __GECODE_SEARCH_SEQ_BFS_HH__
+#define __GECODE_SEARCH_SEQ_BFS_HH__
+
+#include <gecode/search.hh>
+#include <gecode/search/support.hh>
+#include <gecode/search/worker.hh>
+
+namespace Gecode { namespace Search { namespace Seq {
+
+  /**
+   * \brief Implementation of best-first search engine
+   *
+   * Open nodes are kept in a priority queue ordered by the lower
+   * bound of their parent node (nodes created later are preferred
+   * among nodes with the same bound). A node does not store a space
+   * but the archived choices and alternatives that lead to it from
+   * the root: the space of a node is recomputed from the root when
+   * the node is selected. After branching, the engine continues with
+   * the first alternative as long as no open node has a smaller bound.
+   * Once a solution has been found, open nodes whose bound is not
+   * smaller than the bound of the solution are discarded.
+   *
+   */
+  class BFS : public Engine {
+  protected:
+    /// Open node in the search tree
+    class Node : public HeapAllocated {
+    public:
+      /// Lower bound of the parent node
+      double bound;
+      /// Number of node (for breaking ties)
+      unsigned long int n;
+      /// Depth of node
+      unsigned int depth;
+      /// Archived choices and alternatives from the root
+      Archive path;
+      /// Initialize
+      Node(double b, unsigned long int n, unsigned int d, const Archive& p);
+      /// Test whether node must be explored before node \a m
+      bool before(const Node& m) const;
+    };
+    /// Search options
+    Options opt;
+    /// Function returning a lower bound for a space
+    double (*lb)(const Space&);
+    /// Statistics
+    Worker w;
+    /// Root space all nodes are recomputed from
+    Space* root;
+    /// Current space being explored
+    Space* cur;
+    /// Archived choices and alternatives for current space
+    Archive path;
+    /// Depth of current space
+    unsigned int depth;
+    /// Best solution found so far
+    Space* best;
+    /// Lower bound of best solution (infinity if there is none)
+    double bb;
+    /// Priority queue of open nodes (as binary heap)
+    Support::DynamicArray<Node*,Heap> pq;
+    /// Number of open nodes
+    int n_pq;
+    /// Number of nodes created so far
+    unsigned long int n_nodes;
+    /// Add open node for alternative \a a with bound \a b and choice \a c
+    void open(double b, const Archive& c, unsigned int a);
+    /// Remove and return best open node
+    Node* close(void);
+    /// Recompute space for node \a n
+    Space* recompute(Node& n);
+    /// Delete all open nodes
+    void flush(void);
+    /// Update bound from best solution and discard dominated open nodes
+    void prune(void);
+  public:
+    /// Initialize for space \a s, bound function \a b, and options \a o
+    BFS(Space* s, double (*b)(const Space&), const Options& o);
+    /// %Search for next better solution
+    virtual Space* next(void);
+    /// Return statistics
+    virtual Statistics statistics(void) const;
+    /// Check whether engine has been stopped
+    virtual bool stopped(void) const;
+    /// Constrain future solutions to be better than \a b
+    virtual void constrain(const Space& b);
+    /// Reset engine to restart at space \a s
+    virtual void reset(Space* s);
+    /// Destructor
+    virtual ~BFS(void);
+  };
+
+}}}
+
+#endif
+
+// STATISTICS: search-seq
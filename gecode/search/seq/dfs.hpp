@@ -36,7 +36,7 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   DFS<Tracer>::DFS(Space* s, const Options& o)
-    : tracer(o.tracer), opt(o), path(opt.nogoods_limit), d(0) {
+    : tracer(o.tracer), opt(o), path(opt.nogoods_limit,opt.mem_limit), d(0) {
     if (tracer) {
       tracer.engine(SearchTracer::EngineType::DFS, 1U);
       tracer.worker();
@@ -127,6 +127,14 @@ namespace Gecode { namespace Search { namespace Seq {
           }
           // Deletes all pending branchers
           (void) cur->choice();
+          if (opt.visitor != NULL) {
+            // Visit solution in place and continue
+            opt.visitor->solution(*cur);
+            delete cur;
+            cur = NULL;
+            path.next();
+            break;
+          }
           Space* s = cur;
           cur = NULL;
           path.next();
@@ -135,7 +143,7 @@ namespace Gecode { namespace Search { namespace Seq {
       case SS_BRANCH:
         {
           Space* c;
-          if ((d == 0) || (d >= opt.c_d)) {
+          if ((d == 0) || ((d >= opt.c_d) && !path.full())) {
             c = cur->clone();
             d = 1;
           } else {
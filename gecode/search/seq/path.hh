@@ -55,6 +55,11 @@ namespace Gecode { namespace Search { namespace Seq {
    * distance is at least this large, an additional
    * clone is created.
    *
+   * The path keeps track of the memory used by the clones it
+   * stores. If a memory budget is given and exceeded, no adaptive
+   * clones are created and intermediate clones are dropped (the
+   * lowest clone is always kept so that recomputation is possible).
+   *
    */
   template<class Tracer>
   class GECODE_VTABLE_EXPORT Path : public NoGoods {
@@ -67,6 +72,8 @@ namespace Gecode { namespace Search { namespace Seq {
     protected:
       /// Space corresponding to this edge (might be NULL)
       Space* _space;
+      /// Memory allocated by the space (zero if there is no space)
+      size_t _mem;
       /// Current alternative
       unsigned int _alt;
       /// Choice
@@ -83,6 +90,8 @@ namespace Gecode { namespace Search { namespace Seq {
       Space* space(void) const;
       /// Set space to \a s
       void space(Space* s);
+      /// Return memory allocated by the space for the edge
+      size_t memory(void) const;
 
       /// Return choice
       const Choice* choice(void) const;
@@ -111,13 +120,27 @@ namespace Gecode { namespace Search { namespace Seq {
     Support::DynamicStack<Edge,Heap> ds;
     /// Depth limit for no-good generation
     unsigned int _ngdl;
+    /// Memory budget for clones (zero for no budget)
+    size_t _ml;
+    /// Memory allocated by clones on the stack
+    size_t _mem;
+    /// Set space of edge at position \a i to \a s
+    void space(int i, Space* s);
+    /// Remove and dispose topmost edge
+    void pop(void);
+    /// Drop intermediate clones until memory is within budget
+    void shrink(void);
   public:
-    /// Initialize with no-good depth limit \a l
-    Path(unsigned int l);
+    /// Initialize with no-good depth limit \a l and memory budget \a m
+    Path(unsigned int l, size_t m=0);
     /// Return no-good depth limit
     unsigned int ngdl(void) const;
     /// Set no-good depth limit to \a l
     void ngdl(unsigned int l);
+    /// Return memory allocated by clones on the stack
+    size_t memory(void) const;
+    /// Test whether clones on the stack exhaust the memory budget
+    bool full(void) const;
     /// Push space \a c (a clone of \a s or NULL)
     const Choice* push(Worker& stat, Space* s, Space* c, unsigned int nid);
     /// Generate path for next node
@@ -44,7 +44,8 @@ namespace Gecode { namespace Search { namespace Seq {
   template<class Tracer>
   forceinline
   Path<Tracer>::Edge::Edge(Space* s, Space* c, unsigned int nid)
-    : _space(c), _alt(0), _choice(s->choice()), _nid(nid) {}
+    : _space(c), _mem((c != NULL) ? c->allocated() : 0),
+      _alt(0), _choice(s->choice()), _nid(nid) {}
 
   template<class Tracer>
   forceinline Space*
@@ -55,6 +56,12 @@ namespace Gecode { namespace Search { namespace Seq {
   forceinline void
   Path<Tracer>::Edge::space(Space* s) {
     _space = s;
+    _mem = (s != NULL) ? s->allocated() : 0;
+  }
+  template<class Tracer>
+  forceinline size_t
+  Path<Tracer>::Edge::memory(void) const {
+    return _mem;
   }
 
   template<class Tracer>
@@ -116,8 +123,8 @@ namespace Gecode { namespace Search { namespace Seq {
 
   template<class Tracer>
   forceinline
-  Path<Tracer>::Path(unsigned int l)
-    : ds(heap), _ngdl(l) {}
+  Path<Tracer>::Path(unsigned int l, size_t m)
+    : ds(heap), _ngdl(l), _ml(m), _mem(0) {}
 
   template<class Tracer>
   forceinline unsigned int
@@ -131,16 +138,66 @@ namespace Gecode { namespace Search { namespace Seq {
     _ngdl = l;
   }
 
+  template<class Tracer>
+  forceinline size_t
+  Path<Tracer>::memory(void) const {
+    return _mem;
+  }
+
+  template<class Tracer>
+  forceinline bool
+  Path<Tracer>::full(void) const {
+    return (_ml > 0) && (_mem >= _ml);
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::space(int i, Space* s) {
+    _mem -= ds[i].memory();
+    ds[i].space(s);
+    _mem += ds[i].memory();
+  }
+
+  template<class Tracer>
+  forceinline void
+  Path<Tracer>::pop(void) {
+    Edge e = ds.pop();
+    _mem -= e.memory();
+    e.dispose();
+  }
+
+  template<class Tracer>
+  void
+  Path<Tracer>::shrink(void) {
+    int n = ds.entries();
+    // Skip to the lowest clone, it is needed for recomputation
+    int i = 0;
+    while ((i < n) && (ds[i].space() == NULL))
+      i++;
+    // Drop clones from the bottom of the stack as they are used last
+    for (i++; (i < n) && (_mem > _ml); i++)
+      if (ds[i].space() != NULL) {
+        delete ds[i].space();
+        space(i,NULL);
+      }
+  }
+
   template<class Tracer>
   forceinline const Choice*
   Path<Tracer>::push(Worker& stat, Space* s, Space* c, unsigned int nid) {
     if (!ds.empty() && ds.top().lao()) {
       // Topmost stack entry was LAO -> reuse
-      ds.pop().dispose();
+      pop();
     }
     Edge sn(s,c,nid);
     ds.push(sn);
     stat.stack_depth(static_cast<unsigned long int>(ds.entries()));
+    if (c != NULL) {
+      _mem += sn.memory();
+      if ((_ml > 0) && (_mem > _ml))
+        shrink();
+      stat.stack_memory(_mem);
+    }
     return sn.choice();
   }
 
@@ -149,7 +206,7 @@ namespace Gecode { namespace Search { namespace Seq {
   Path<Tracer>::next(void) {
     while (!ds.empty())
       if (ds.top().rightmost()) {
-        ds.pop().dispose();
+        pop();
       } else {
         ds.top().next();
         return;
@@ -204,11 +261,11 @@ namespace Gecode { namespace Search { namespace Seq {
           SearchTracer::EdgeInfo ei(t.wid(),top.nid(),a);
           t.skip(ei);
         }
-        ds.pop().dispose();
+        pop();
       }
     } else {
       for (int i=l; i<n; i++)
-        ds.pop().dispose();
+        pop();
     }
     assert(ds.entries() == l);
   }
@@ -217,7 +274,8 @@ namespace Gecode { namespace Search { namespace Seq {
   inline void
   Path<Tracer>::reset(void) {
     while (!ds.empty())
-      ds.pop().dispose();
+      pop();
+    assert(_mem == 0);
   }
 
   template<class Tracer>
@@ -233,7 +291,7 @@ namespace Gecode { namespace Search { namespace Seq {
       Space* s = ds.top().space();
       s->commit(*ds.top().choice(),ds.top().alt());
       assert(ds.entries()-1 == lc());
-      ds.top().space(NULL);
+      space(ds.entries()-1,NULL);
       // Mark as reusable
       if (static_cast<unsigned int>(ds.entries()) > ngdl())
         ds.top().next();
@@ -262,7 +320,7 @@ namespace Gecode { namespace Search { namespace Seq {
       for (; (i<n) && ds[i].rightmost(); i++)
         commit(s,i);
       // Is there any point to make a copy?
-      if (i<n-1) {
+      if ((i<n-1) && !full()) {
         // Propagate to fixpoint
         SpaceStatus ss = s->status(stat);
         /*
@@ -276,7 +334,10 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        space(i,s->clone());
+        if ((_ml > 0) && (_mem > _ml))
+          shrink();
+        stat.stack_memory(_mem);
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
@@ -304,7 +365,7 @@ namespace Gecode { namespace Search { namespace Seq {
         mark = ds.entries()-1;
         s->constrain(best);
       }
-      ds.top().space(NULL);
+      space(ds.entries()-1,NULL);
       // Mark as reusable
       if (static_cast<unsigned int>(ds.entries()) > ngdl())
         ds.top().next();
@@ -334,7 +395,7 @@ namespace Gecode { namespace Search { namespace Seq {
       // copy: a copy might be much smaller due to flushed caches
       // of propagators
       Space* c = s->clone();
-      ds[l].space(c);
+      space(l,c);
     } else {
       s = s->clone();
     }
@@ -353,7 +414,7 @@ namespace Gecode { namespace Search { namespace Seq {
       for (; (i<n) && ds[i].rightmost(); i++)
         commit(s,i);
       // Is there any point to make a copy?
-      if (i<n-1) {
+      if ((i<n-1) && !full()) {
         // Propagate to fixpoint
         SpaceStatus ss = s->status(stat);
         /*
@@ -370,7 +431,10 @@ namespace Gecode { namespace Search { namespace Seq {
           unwind(i,t);
           return NULL;
         }
-        ds[i].space(s->clone());
+        space(i,s->clone());
+        if ((_ml > 0) && (_mem > _ml))
+          shrink();
+        stat.stack_memory(_mem);
         d = static_cast<unsigned int>(n-i);
       }
       // Finally do the remaining commits
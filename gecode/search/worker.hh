@@ -60,6 +60,8 @@ namespace Gecode { namespace Search {
     void reset(unsigned long int d=0);
     /// Record stack depth \a d
     void stack_depth(unsigned long int d);
+    /// Record memory \a m of clones on stack
+    void stack_memory(size_t m);
     /// Return steal depth
     unsigned long int steal_depth(unsigned long int d) const;
   };
@@ -102,6 +104,12 @@ namespace Gecode { namespace Search {
       depth = root_depth + d;
   }
 
+  forceinline void
+  Worker::stack_memory(size_t m) {
+    if (memory < m)
+      memory = m;
+  }
+
   forceinline unsigned long int
   Worker::steal_depth(unsigned long int d) const {
     return root_depth + d;
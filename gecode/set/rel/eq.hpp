@@ -75,8 +75,8 @@ namespace Gecode { namespace Set { namespace Rel {
     if (testSetEventLB(me0,me1)) {
       GlbRanges<View0> x0lb(x0);
       GlbRanges<View1> x1lb(x1);
-      Iter::Ranges::Union<GlbRanges<View0>,GlbRanges<View1> > lbu(x0lb,x1lb);
-      Iter::Ranges::Cache lbuc(r,lbu);
+      Iter::Ranges::Buffer lbuc(r);
+      lbuc.unite(x0lb,x1lb);
       GECODE_ME_CHECK(x0.includeI(home,lbuc));
       lbuc.reset();
       GECODE_ME_CHECK(x1.includeI(home,lbuc));
@@ -85,8 +85,8 @@ namespace Gecode { namespace Set { namespace Rel {
     if (testSetEventUB(me0,me1)) {
       LubRanges<View0> x0ub(x0);
       LubRanges<View1> x1ub(x1);
-      Iter::Ranges::Inter<LubRanges<View0>,LubRanges<View1> > ubi(x0ub,x1ub);
-      Iter::Ranges::Cache ubic(r,ubi);
+      Iter::Ranges::Buffer ubic(r);
+      ubic.inter(x0ub,x1ub);
       GECODE_ME_CHECK(x0.intersectI(home,ubic));
       ubic.reset();
       GECODE_ME_CHECK(x1.intersectI(home,ubic));
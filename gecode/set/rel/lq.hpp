@@ -274,13 +274,13 @@ namespace Gecode { namespace Set { namespace Rel {
     : xlm(false), xum(false), ylm(false), yum(false) {
     LubRanges<View0> xlub(x);
     LubRanges<View1> ylub(y);
-    Iter::Ranges::Union<LubRanges<View0>,LubRanges<View1> > xylub(xlub,ylub);
-    Iter::Ranges::Cache xylubc(re,xylub);
+    Iter::Ranges::Buffer xylubc(re);
+    xylubc.unite(xlub,ylub);
     xsize = Iter::Ranges::size(xylubc);
     b.init(re,4*xsize);
     ub = re.alloc<int>(xsize);
     xylubc.reset();
-    Iter::Ranges::ToValues<Iter::Ranges::Cache> xylubv(xylubc);
+    Iter::Ranges::ToValues<Iter::Ranges::Buffer> xylubv(xylubc);
     LubRanges<View0> xur(x);
     GlbRanges<View0> xlr(x);
     LubRanges<View1> yur(y);
@@ -90,6 +90,8 @@ namespace Gecode { namespace Support {
     void set(unsigned int i);
     /// Clear bit \a i
     void clear(unsigned int i);
+    /// Clear bits \a i to \a j (both inclusive, \a i <= \a j < bpb)
+    void clear(unsigned int i, unsigned int j);
     /// Return next set bit with position greater or equal to \a i (there must be a bit)
     unsigned int next(unsigned int i=0U) const;
     /// Whether all bits are set
@@ -266,6 +268,13 @@ namespace Gecode { namespace Support {
   BitSetData::clear(unsigned int i) {
     bits &= ~(static_cast<Base>(1U) << i);
   }
+  forceinline void
+  BitSetData::clear(unsigned int i, unsigned int j) {
+    assert((i <= j) && (j < bpb));
+    const Base mask = ((~static_cast<Base>(0U)) >> (bpb-1U-j)) &
+      ((~static_cast<Base>(0U)) << i);
+    bits &= ~mask;
+  }
   forceinline unsigned int
   BitSetData::next(unsigned int i) const {
     assert(bits != static_cast<Base>(0));
@@ -268,6 +268,52 @@ namespace Test {
     }
   } sharedArrayIteratorTest;
 
+  /// %Class for testing bound updates for all views of a ViewArray
+  class ViewArrayGq : public Test::Base {
+  public:
+    /// Initialize test
+    ViewArrayGq(void) : Test::Base("Array::ViewArray::Gq") {}
+    /// Perform actual tests
+    bool run(void) {
+      using namespace Gecode;
+      // Test/problem information.
+      const char* test    = "NONE";
+      const char* problem = "NONE";
+      // Space for the test
+      TestSpace s;
+      IntVarArgs x(s,3,0,5);
+      ViewArray<Int::IntView> a(s,x);
+
+      START_TEST("Bounds already satisfied");
+      {
+        const int b[] = {0,-1,0};
+        CHECK_TEST(a.gq(s,b) == ES_FIX,"Status != ES_FIX");
+        CHECK_TEST((x[0].min() == 0) && (x[1].min() == 0) &&
+                   (x[2].min() == 0),"Bounds modified");
+      }
+      START_TEST("Bounds updated");
+      {
+        const int b[] = {2,0,5};
+        CHECK_TEST(a.gq(s,b) == ES_NOFIX,"Status != ES_NOFIX");
+        CHECK_TEST((x[0].min() == 2) && (x[1].min() == 0) &&
+                   x[2].assigned() && (x[2].val() == 5),"Wrong bounds");
+        CHECK_TEST(a.gq(s,b) == ES_FIX,"Status != ES_FIX");
+      }
+      START_TEST("Bound update fails");
+      {
+        const int b[] = {3,6,0};
+        CHECK_TEST(a.gq(s,b) == ES_FAILED,"Status != ES_FAILED");
+      }
+      return true;
+    failed:
+      if (opt.log)
+        olog << "FAILURE" << std::endl
+        << ind(1) << "Test:       " << test << std::endl
+        << ind(1) << "Problem:    " << problem << std::endl;
+      return false;
+    }
+  } viewArrayGqTest;
+
 }}
 
 // STATISTICS: test-core
@@ -33,6 +33,9 @@
 
 #include "test/int.hh"
 
+#include <algorithm>
+#include <vector>
+
 namespace Test { namespace Int {
 
    /// %Tests for basic setup
@@ -51,8 +54,8 @@ namespace Test { namespace Int {
        Basic(int n)
          : Test("Basic::A",3,-n,n,true) {}
        /// Initialize test
-       Basic(Gecode::IntArgs& i)
-         : Test("Basic::B",3,Gecode::IntSet(i),true) {}
+       Basic(const std::string& s, Gecode::IntArgs& i)
+         : Test("Basic::"+s,3,Gecode::IntSet(i),true) {}
        /// Check whether \a x is a solution
        virtual bool solution(const Assignment&) const {
          return true;
@@ -68,9 +71,137 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test membership of domains represented with bitsets
+     class Bits : public Base {
+     protected:
+       /// Initial minimum and maximum of the domain
+       int l, u;
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// Integer variable
+         Gecode::IntVar x;
+         /// Constructor
+         TestSpace(int l, int u) : x(*this,l,u) {}
+         /// Constructor for cloning \a s
+         TestSpace(TestSpace& s) : Gecode::Space(s) {
+           x.update(*this,s.x);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+       /// Test whether the domain of \a s agrees with the values in \a d
+       bool consistent(TestSpace& s, const std::vector<bool>& d) const {
+         Gecode::Int::IntView x(s.x);
+         unsigned int n = 0;
+         for (int v=l-2; v<=u+2; v++) {
+           bool in = (v >= l) && (v <= u) && d[v-l];
+           if (x.in(v) != in)
+             return false;
+           if (in)
+             n++;
+         }
+         return x.size() == n;
+       }
+     public:
+       /// Create and register test
+       Bits(int l0, int u0)
+         : Base("Int::Basic::Bits::"+Test::str(l0)+"::"+Test::str(u0)), l(l0), u(u0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         TestSpace* s = new TestSpace(l,u);
+         std::vector<bool> d(u-l+1,true);
+         for (int k=0; k<200; k++) {
+           Gecode::Int::IntView x(s->x);
+           int m = x.min() + static_cast<int>(rand(x.width()));
+           ModEvent me = Gecode::Int::ME_INT_NONE;
+           switch (rand(6)) {
+           case 0:
+             // Remove a single value
+             me = x.nq(*s,m);
+             d[m-l] = false;
+             break;
+           case 1:
+             {
+               // Remove a range of values
+               int n = std::min(m + static_cast<int>(rand(16)), x.max());
+               Iter::Ranges::Singleton r(m,n);
+               me = x.minus_r(*s,r,rand(2) == 0);
+               for (int v=m; v<=n; v++)
+                 d[v-l] = false;
+             }
+             break;
+           case 2:
+             {
+               // Remove some values
+               IntArgs a;
+               for (int v=m; v<=x.max(); v += 1 + static_cast<int>(rand(8)))
+                 a << v;
+               Iter::Values::Array r(&a[0],a.size());
+               me = x.minus_v(*s,r,rand(2) == 0);
+               for (int i=0; i<a.size(); i++)
+                 d[a[i]-l] = false;
+             }
+             break;
+           case 3:
+             {
+               // Keep only some of the remaining values
+               IntArgs a;
+               for (int v=x.min(); v<=x.max(); v++)
+                 if (d[v-l] && ((v == x.min()) || (rand(8) != 0)))
+                   a << v;
+                 else
+                   d[v-l] = false;
+               IntSet is(a);
+               IntSetRanges r(is);
+               me = x.narrow_r(*s,r,rand(2) == 0);
+             }
+             break;
+           case 4:
+             // Narrow the bounds
+             if (rand(2) == 0) {
+               me = x.gq(*s,m);
+               for (int v=l; v<m; v++)
+                 d[v-l] = false;
+             } else {
+               me = x.lq(*s,m);
+               for (int v=m+1; v<=u; v++)
+                 d[v-l] = false;
+             }
+             break;
+           case 5:
+             {
+               // Clone the space
+               (void) s->status();
+               TestSpace* c = static_cast<TestSpace*>(s->clone());
+               delete s; s = c;
+             }
+             break;
+           }
+           if (me_failed(me) || x.assigned())
+             break;
+           if (!consistent(*s,d)) {
+             delete s; return false;
+           }
+         }
+         delete s;
+         return true;
+       }
+     };
+
      Gecode::IntArgs i({1,2,3,4});
+     Gecode::IntArgs j({-7,-3,0,5,60});
+     Gecode::IntArgs k({-1000,-3,0,5,1000});
      Basic b1(3);
-     Basic b2(i);
+     Basic b2("B",i);
+     Basic b3("C",j);
+     Basic b4("D",k);
+     Bits bs1(-500,500);
+     Bits bs2(0,1023);
+     Bits bs3(-1000,1000);
      //@}
 
    }
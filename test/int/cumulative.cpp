@@ -577,6 +577,54 @@ namespace Test { namespace Int {
     };
 
     Create c;
+
+    /// Test for tasks that exceed a variable capacity outside required parts
+    class VarCap : public Base {
+    protected:
+      /// Propagation level
+      Gecode::IntPropLevel ipl;
+      /// %Test space
+      class TestSpace : public Gecode::Space {
+      public:
+        /// Start times
+        Gecode::IntVarArray s;
+        /// Capacity
+        Gecode::IntVar c;
+        /// Constructor
+        TestSpace(void) : s(*this,2,0,20), c(*this,0,5) {}
+        /// Constructor for cloning \a t
+        TestSpace(TestSpace& t) : Gecode::Space(t) {
+          s.update(*this,t.s); c.update(*this,t.c);
+        }
+        /// Copy space during cloning
+        virtual Gecode::Space* copy(void) {
+          return new TestSpace(*this);
+        }
+      };
+    public:
+      /// Create and register test
+      VarCap(Gecode::IntPropLevel ipl0)
+        : Base("Int::Cumulative::VarCap::"+Test::str(ipl0)), ipl(ipl0) {}
+      /// Perform test
+      virtual bool run(void) {
+        using namespace Gecode;
+        TestSpace* t = new TestSpace;
+        rel(*t, t->s[0], IRT_EQ, 0);
+        rel(*t, t->s[1], IRT_GQ, 10);
+        cumulative(*t, t->c, t->s, IntArgs({2,2}), IntArgs({1,3}), ipl);
+        if (t->status() == SS_FAILED) {
+          delete t; return false;
+        }
+        // The second task does not fit anywhere
+        rel(*t, t->c, IRT_LQ, 2);
+        bool ok = (t->status() == SS_FAILED);
+        delete t;
+        return ok;
+      }
+    };
+
+    VarCap vcb(Gecode::IPL_BASIC);
+    VarCap vcba(Gecode::IPL_BASIC_ADVANCED);
     //@}
 
   }
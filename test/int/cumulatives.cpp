@@ -190,8 +190,10 @@ namespace Test { namespace Int {
        int limit;    ///< Limit
      public:
        /// Create and register test
-       Cumulatives(const std::string& s, int nt, bool am, int l)
-         : Test("Cumulatives::"+s,nt*4,-1,2), ntasks(nt), at_most(am), limit(l) {
+       Cumulatives(const std::string& s, int nt, bool am, int l,
+                   Gecode::IntPropLevel ipl=Gecode::IPL_DEF)
+         : Test("Cumulatives::"+s,nt*4,-1,2,false,ipl),
+           ntasks(nt), at_most(am), limit(l) {
          testsearch = false;
        }
        /// Create first assignment
@@ -236,7 +238,7 @@ namespace Test { namespace Int {
            e[i] = x[p+2]; rel(home, x[p+2], Gecode::IRT_GQ, 1);
            h[i] = x[p+3];
          }
-         cumulatives(home, m, s, d, e, h, l, at_most);
+         cumulatives(home, m, s, d, e, h, l, at_most, ipl);
        }
      };
 
@@ -264,6 +266,72 @@ namespace Test { namespace Int {
      Cumulatives c3f_2("3f-2", 3, false, -2);
      Cumulatives c3t_3("3t-3", 3,  true, -3);
      Cumulatives c3f_3("3f-3", 3, false, -3);
+
+     Cumulatives c2t1a("2t1::A", 2,  true, 1, Gecode::IPL_ADVANCED);
+     Cumulatives c2t2a("2t2::A", 2,  true, 2, Gecode::IPL_ADVANCED);
+     Cumulatives c3t1a("3t1::A", 3,  true, 1, Gecode::IPL_ADVANCED);
+     Cumulatives c3t2a("3t2::A", 3,  true, 2, Gecode::IPL_ADVANCED);
+     Cumulatives c3t_1a("3t-1::A", 3,  true, -1, Gecode::IPL_ADVANCED);
+
+     /// %Test energetic reasoning for tasks spanning the full integer range
+     class Wide : public Base {
+     protected:
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// Start and end times
+         Gecode::IntVarArray s, e;
+         /// Constructor
+         TestSpace(int n)
+           : s(*this,n,Gecode::Int::Limits::min,Gecode::Int::Limits::max),
+             e(*this,n,Gecode::Int::Limits::min,Gecode::Int::Limits::max) {}
+         /// Constructor for cloning \a t
+         TestSpace(TestSpace& t) : Gecode::Space(t) {
+           s.update(*this,t.s); e.update(*this,t.e);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+     public:
+       /// Create and register test
+       Wide(void) : Base("Int::Cumulatives::Wide") {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         const int min = Gecode::Int::Limits::min;
+         const int max = Gecode::Int::Limits::max;
+         // Two unit tasks on a machine with capacity one
+         TestSpace* t = new TestSpace(2);
+         cumulatives(*t, IntArgs({0,0}), t->s, IntArgs({1,1}), t->e,
+                     IntArgs({1,1}), IntArgs({1}), true, IPL_ADVANCED);
+         if (t->status() == SS_FAILED) {
+           delete t; return false;
+         }
+         // Place the tasks at both ends of the horizon
+         {
+           TestSpace* c = static_cast<TestSpace*>(t->clone());
+           rel(*c, c->s[0], IRT_EQ, min);
+           rel(*c, c->e[1], IRT_EQ, max);
+           bool ok = (c->status() != SS_FAILED);
+           delete c;
+           if (!ok) {
+             delete t; return false;
+           }
+         }
+         // Both tasks at the same time exceed the capacity
+         for (int i=0; i<2; i++) {
+           rel(*t, t->s[i], IRT_EQ, 0);
+           rel(*t, t->e[i], IRT_EQ, 1);
+         }
+         bool ok = (t->status() == SS_FAILED);
+         delete t;
+         return ok;
+       }
+     };
+
+     Wide w;
      //@}
 
    }
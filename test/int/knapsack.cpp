@@ -0,0 +1,118 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+
+#include <gecode/minimodel.hh>
+#include "test/int.hh"
+
+namespace Test { namespace Int {
+
+   /// %Tests for knapsack constraints
+   namespace Knapsack {
+
+     /**
+      * \defgroup TaskTestIntKnapsack Knapsack constraints
+      * \ingroup TaskTestInt
+      */
+     //@{
+     /// %Test knapsack constraint
+     class Knapsack : public Test {
+     protected:
+       /// Weights of items
+       Gecode::IntArgs w;
+       /// Profits of items
+       Gecode::IntArgs p;
+     public:
+       /// Create and register test
+       Knapsack(const std::string& s, const Gecode::IntSet& d,
+                const Gecode::IntArgs& w0, const Gecode::IntArgs& p0)
+         : Test("Knapsack::"+s,w0.size()+2,d), w(w0), p(p0) {
+         testfix=false;
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         int n = w.size();
+         for (int i=0; i<n; i++)
+           if ((x[i] < 0) || (x[i] > 1))
+             return false;
+         int sw = 0, sp = 0;
+         for (int i=0; i<n; i++) {
+           sw += w[i]*x[i]; sp += p[i]*x[i];
+         }
+         return (sw == x[n]) && (sp == x[n+1]);
+       }
+       /// %Test whether \a x is to be ignored
+       virtual bool ignore(const Assignment& x) const {
+         for (int i=0; i<w.size(); i++)
+           if ((x[i] < 0) || (x[i] > 1))
+             return true;
+         return false;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         int n = w.size();
+         Gecode::BoolVarArgs y(n);
+         for (int i=n; i--; )
+           y[i] = Gecode::channel(home,x[i]);
+         Gecode::knapsack(home, w, p, y, x[n], x[n+1]);
+       }
+     };
+
+     /// Help class to create and register tests
+     class Create {
+     public:
+       /// Perform creation and registration
+       Create(void) {
+         using namespace Gecode;
+         (void) new Knapsack("1",IntSet(-2,6),
+                             IntArgs({2,3,1}),IntArgs({1,-2,3}));
+         (void) new Knapsack("2",IntSet(0,5),
+                             IntArgs({1,2,2,3}),IntArgs({2,1,3,1}));
+         (void) new Knapsack("3",IntSet(0,5),
+                             IntArgs({0,4,2,1}),IntArgs({1,0,2,2}));
+         // Large weights, but small enough for the tables
+         (void) new Knapsack("5",IntSet({0,1,2,3,10000,25000,35000}),
+                             IntArgs({10000,25000}),IntArgs({2,1}));
+         // Too large for the tables, only the linear constraints are posted
+         (void) new Knapsack("4",IntSet({0,1,2,2000000,2000001}),
+                             IntArgs({1,2000000}),IntArgs({1,1}));
+       }
+     };
+
+     Create c;
+     //@}
+
+   }
+}}
+
+// STATISTICS: test-int
@@ -257,6 +257,101 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test propagation strength of Boolean inequalities with watched views
+     class BoolWatch : public Base {
+     protected:
+       /// Coefficients (all positive)
+       Gecode::IntArgs a;
+       /// Righthand-side constant
+       int c;
+       /// %Test space
+       class TestSpace : public Gecode::Space {
+       public:
+         /// Boolean variables
+         Gecode::BoolVarArray x;
+         /// Constructor
+         TestSpace(int n) : x(*this,n,0,1) {}
+         /// Constructor for cloning \a s
+         TestSpace(TestSpace& s) : Gecode::Space(s) {
+           x.update(*this,s.x);
+         }
+         /// Copy space during cloning
+         virtual Gecode::Space* copy(void) {
+           return new TestSpace(*this);
+         }
+       };
+       /// Test whether all views with coefficient larger than slack are one
+       bool consistent(const TestSpace& s) const {
+         long long int sl = -c;
+         for (int i=0; i<a.size(); i++)
+           if (!s.x[i].zero())
+             sl += a[i];
+         for (int i=0; i<a.size(); i++)
+           if (s.x[i].none() && (a[i] > sl))
+             return false;
+         return true;
+       }
+     public:
+       /// Create and register test
+       BoolWatch(const std::string& n, const Gecode::IntArgs& a0, int c0)
+         : Base("Int::Linear::Bool::Watch::"+n+"::"+Test::str(c0)),
+           a(a0), c(c0) {}
+       /// Perform test
+       virtual bool run(void) {
+         using namespace Gecode;
+         int n = a.size();
+         // Assign views to zero one by one, starting at every view
+         for (int f=0; f<n; f++) {
+           TestSpace* s = new TestSpace(n);
+           linear(*s, a, s->x, IRT_GQ, c);
+           for (int k=0; k<n; k++) {
+             if (s->status() == SS_FAILED)
+               break;
+             if (!consistent(*s)) {
+               delete s; return false;
+             }
+             int i = (f+k) % n;
+             if (s->x[i].none())
+               rel(*s, s->x[i], IRT_EQ, 0);
+           }
+           delete s;
+         }
+         return true;
+       }
+     };
+
+     /// %Test network of difference constraints
+     class Difference : public Test {
+     protected:
+       /// Indices of the views in the constraint network
+       Gecode::IntArgs v;
+       /// Start, constant, and target of the difference constraints
+       Gecode::IntArgs s, c, t;
+     public:
+       /// Create and register test
+       Difference(const std::string& n, int a, const Gecode::IntSet& d,
+                  const Gecode::IntArgs& v0, const Gecode::IntArgs& s0,
+                  const Gecode::IntArgs& c0, const Gecode::IntArgs& t0)
+         : Test("Linear::Difference::"+n,a,d,false,Gecode::IPL_BND),
+           v(v0), s(s0), c(c0), t(t0) {
+         testfix=false;
+       }
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=0; i<c.size(); i++)
+           if (x[v[s[i]]] + c[i] > x[v[t[i]]])
+             return false;
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         Gecode::IntVarArgs y(v.size());
+         for (int i=0; i<v.size(); i++)
+           y[i] = x[v[i]];
+         Gecode::difference(home, y, s, c, t);
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -354,6 +449,7 @@ namespace Test { namespace Int {
            IntArgs a3({1,2,3,4,5});
            IntArgs a4({-1,-2,-3,-4,-5});
            IntArgs a5({-1,-2,1,2,4});
+           IntArgs a10({6,1,3,1,2,1});
 
            for (IntRelTypes irts; irts(); ++irts) {
              for (int c=0; c<=16; c++) {
@@ -361,6 +457,7 @@ namespace Test { namespace Int {
                (void) new BoolInt("4",a4,irts.irt(),-c);
                (void) new BoolInt("5",a5,irts.irt(),c);
                (void) new BoolInt("6",a5,irts.irt(),-c);
+               (void) new BoolInt("7",a10,irts.irt(),c);
              }
            }
 
@@ -386,6 +483,49 @@ namespace Test { namespace Int {
            }
 
          }
+         {
+           IntArgs a1({3,2,1,1});
+           IntArgs a2({6,3,2,1,1,1});
+           IntArgs a3({5,4,3,2,1});
+           for (int c=1; c<=7; c++) {
+             (void) new BoolWatch("1",a1,c);
+             (void) new BoolWatch("2",a2,c);
+           }
+           for (int c=1; c<=15; c++)
+             (void) new BoolWatch("3",a3,c);
+         }
+         {
+           IntSet d(-2,2);
+           const int dv[] = {-3,-1,0,2,3};
+           IntSet dh(dv,5);
+           // A cycle of length zero
+           (void) new Difference("1",4,d,IntArgs({0,1,2,3}),
+                                 IntArgs({0,1,2,3}),IntArgs({1,0,-1,0}),
+                                 IntArgs({1,2,3,0}));
+           (void) new Difference("2",4,dh,IntArgs({0,1,2,3}),
+                                 IntArgs({0,1,2,3,0}),
+                                 IntArgs({1,0,-1,-2,2}),
+                                 IntArgs({1,2,3,0,2}));
+           // A cycle of positive length
+           (void) new Difference("3",3,d,IntArgs({0,1,2}),
+                                 IntArgs({0,1,2}),IntArgs({1,0,0}),
+                                 IntArgs({1,2,0}));
+           // Constraints on a single view
+           (void) new Difference("4",2,d,IntArgs({0,1}),
+                                 IntArgs({0,1,0}),IntArgs({0,-1,1}),
+                                 IntArgs({0,1,1}));
+           // The same variable for several views
+           (void) new Difference("5",3,d,IntArgs({0,1,2,0}),
+                                 IntArgs({0,1,2}),IntArgs({1,1,-3}),
+                                 IntArgs({1,2,3}));
+           // A cycle of positive length through the same variable
+           (void) new Difference("6",1,d,IntArgs({0,0}),
+                                 IntArgs({0}),IntArgs({1}),IntArgs({1}));
+           // A cycle of length zero through the same variable
+           (void) new Difference("7",2,d,IntArgs({0,1,0}),
+                                 IntArgs({0,1}),IntArgs({1,-1}),
+                                 IntArgs({1,2}));
+         }
        }
      };
 
@@ -568,6 +568,144 @@ namespace Test { namespace Int {
        }
      };
 
+     /// %Test for relation between consecutive rows of integer variables
+     class IntArrayChain : public Test {
+     protected:
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// Width of each row
+       int w;
+     public:
+       /// Create and register test
+       IntArrayChain(Gecode::IntRelType irt0, int w0)
+         : Test("Rel::Int::Array::Chain::"+str(irt0)+"::"+str(w0),6,-2,2),
+           irt(irt0), w(w0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=w; i<x.size(); i+=w) {
+           int k=0;
+           while ((k < w) && (x[i-w+k] == x[i+k]))
+             k++;
+           if (k < w) {
+             if (!cmp(x[i-w+k],irt,x[i+k]))
+               return false;
+           } else if ((irt == Gecode::IRT_LE) || (irt == Gecode::IRT_GR) ||
+                      (irt == Gecode::IRT_NQ)) {
+             return false;
+           }
+         }
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         rel(home, IntVarArgs(x), w, irt);
+       }
+     };
+
+     /// %Test for relation between consecutive rows of Boolean variables
+     class BoolArrayChain : public Test {
+     protected:
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// Width of each row
+       int w;
+     public:
+       /// Create and register test
+       BoolArrayChain(Gecode::IntRelType irt0, int w0)
+         : Test("Rel::Bool::Array::Chain::"+str(irt0)+"::"+str(w0),12,0,1),
+           irt(irt0), w(w0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         for (int i=w; i<x.size(); i+=w) {
+           int k=0;
+           while ((k < w) && (x[i-w+k] == x[i+k]))
+             k++;
+           if (k < w) {
+             if (!cmp(x[i-w+k],irt,x[i+k]))
+               return false;
+           } else if ((irt == Gecode::IRT_LE) || (irt == Gecode::IRT_GR) ||
+                      (irt == Gecode::IRT_NQ)) {
+             return false;
+           }
+         }
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         BoolVarArgs y(x.size());
+         for (int i=0; i<x.size(); i++)
+           y[i]=channel(home,x[i]);
+         rel(home, y, w, irt);
+       }
+     };
+
+     /// %Test for relation between consecutive rows or columns of a matrix
+     class MatrixLex : public Test {
+     protected:
+       /// Integer relation type to propagate
+       Gecode::IntRelType irt;
+       /// Whether to order columns rather than rows
+       bool cols;
+       /// Whether to use Boolean variables
+       bool bv;
+       /// Width of the matrix
+       int w;
+       /// Height of the matrix
+       int h;
+       /// Return value at position \a k of row or column \a i
+       int at(const Assignment& x, int i, int k) const {
+         return cols ? x[k*w+i] : x[i*w+k];
+       }
+     public:
+       /// Create and register test
+       MatrixLex(Gecode::IntRelType irt0, bool cols0, bool bv0, int w0)
+         : Test(std::string("Rel::Matrix::")+(bv0 ? "Bool" : "Int")+"::"+
+                (cols0 ? "Columns" : "Rows")+"::"+str(irt0)+"::"+str(w0),
+                6,bv0 ? 0 : -2,bv0 ? 1 : 2),
+           irt(irt0), cols(cols0), bv(bv0), w(w0), h(6/w0) {}
+       /// %Test whether \a x is solution
+       virtual bool solution(const Assignment& x) const {
+         // Number and length of the lines to be ordered
+         int n = cols ? w : h;
+         int l = cols ? h : w;
+         for (int i=1; i<n; i++) {
+           int k=0;
+           while ((k < l) && (at(x,i-1,k) == at(x,i,k)))
+             k++;
+           if (k < l) {
+             if (!cmp(at(x,i-1,k),irt,at(x,i,k)))
+               return false;
+           } else if ((irt == Gecode::IRT_LE) || (irt == Gecode::IRT_GR) ||
+                      (irt == Gecode::IRT_NQ)) {
+             return false;
+           }
+         }
+         return true;
+       }
+       /// Post constraint on \a x
+       virtual void post(Gecode::Space& home, Gecode::IntVarArray& x) {
+         using namespace Gecode;
+         if (bv) {
+           BoolVarArgs y(x.size());
+           for (int i=0; i<x.size(); i++)
+             y[i]=channel(home,x[i]);
+           Matrix<BoolVarArgs> m(y,w,h);
+           if (cols)
+             columns_lex(home, m, irt);
+           else
+             rows_lex(home, m, irt);
+         } else {
+           Matrix<IntVarArgs> m(IntVarArgs(x),w,h);
+           if (cols)
+             columns_lex(home, m, irt);
+           else
+             rows_lex(home, m, irt);
+         }
+       }
+     };
+
      /// Help class to create and register tests
      class Create {
      public:
@@ -614,6 +752,15 @@ namespace Test { namespace Int {
              (void) new IntArrayDiff(irts.irt(),n_fst);
            (void) new BoolArrayVar(irts.irt());
            (void) new BoolArrayInt(irts.irt());
+           for (int w=1; w<=3; w++)
+             (void) new IntArrayChain(irts.irt(),w);
+           for (int w=2; w<=6; w+=2)
+             (void) new BoolArrayChain(irts.irt(),w);
+           for (int w=2; w<=3; w++)
+             for (int c=0; c<=1; c++) {
+               (void) new MatrixLex(irts.irt(),c == 1,false,w);
+               (void) new MatrixLex(irts.irt(),c == 1,true,w);
+             }
          }
        }
      };
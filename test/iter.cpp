@@ -0,0 +1,224 @@
+/* -*- mode: C++; c-basic-offset: 2; indent-tabs-mode: nil -*- */
+/*
+ *  Main authors:
+ *     agent <agent@local>
+ *
+ *  Copyright:
+ *     agent, 2026
+ *
+ *  This file is part of Gecode, the generic constraint
+ *  development environment:
+ *     http://www.gecode.org
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining
+ *  a copy of this software and associated documentation files (the
+ *  "Software"), to deal in the Software without restriction, including
+ *  without limitation the rights to use, copy, modify, merge, publish,
+ *  distribute, sublicense, and/or sell copies of the Software, and to
+ *  permit persons to whom the Software is furnished to do so, subject to
+ *  the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be
+ *  included in all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *  EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *  MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ *  NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+ *  LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+ *  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+ *  WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ */
+
+#include <gecode/iter.hh>
+#include <gecode/kernel.hh>
+
+#include "test/test.hh"
+
+#include <sstream>
+
+namespace Test {
+
+  /// %Tests for iterators
+  namespace Iter {
+
+    /// %Test union of many range iterators
+    class NaryUnion : public Test::Base {
+    protected:
+      /// Number of iterators
+      int n;
+      /// Largest value in iterators
+      static const int v_max = 63;
+      /// How often to repeat
+      static const int n_repeat = 32;
+      /// Range array type
+      typedef Gecode::Iter::Ranges::Array::Range Range;
+      /// Map integer to string
+      static std::string str(int i) {
+        std::stringstream s;
+        s << i;
+        return s.str();
+      }
+    public:
+      /// Initialize test
+      NaryUnion(int n0)
+        : Test::Base("Iter::Ranges::NaryUnion::"+str(n0)), n(n0) {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        for (int k=n_repeat; k--; ) {
+          Region r;
+          bool u[v_max+1];
+          for (int v=0; v<=v_max; v++)
+            u[v] = false;
+          Gecode::Iter::Ranges::Array* a =
+            r.alloc<Gecode::Iter::Ranges::Array>(n);
+          for (int i=0; i<n; i++) {
+            // Every fourth iterator is empty
+            int d = (rand(4) == 0) ? 0 : 1+rand(4);
+            bool b[v_max+1];
+            for (int v=0; v<=v_max; v++) {
+              b[v] = (d > 0) && (rand(d+1) == 0);
+              u[v] |= b[v];
+            }
+            Range* ri = r.alloc<Range>(v_max+1);
+            int m = 0;
+            for (int v=0; v<=v_max; v++)
+              if (b[v]) {
+                if ((m > 0) && (ri[m-1].max+1 == v)) {
+                  ri[m-1].max = v;
+                } else {
+                  ri[m].min = ri[m].max = v; m++;
+                }
+              }
+            a[i].init(ri,m);
+          }
+          Gecode::Iter::Ranges::NaryUnion nu(r,a,n);
+          // Check that the union has maximal and sorted ranges
+          int v = 0;
+          for (; nu(); ++nu) {
+            for (; v < nu.min(); v++)
+              if (u[v])
+                return false;
+            if ((v > 0) && (v == nu.min()) && u[v-1])
+              return false;
+            for (; v <= nu.max(); v++)
+              if ((v > v_max) || !u[v])
+                return false;
+          }
+          for (; v <= v_max; v++)
+            if (u[v])
+              return false;
+        }
+        return true;
+      }
+    };
+
+    NaryUnion nu8(8);
+    NaryUnion nu9(9);
+    NaryUnion nu16(16);
+    NaryUnion nu33(33);
+
+    /// %Test buffer of ranges filled by union, intersection, and difference
+    class Buffer : public Test::Base {
+    protected:
+      /// Operation to test
+      int o;
+      /// Largest value in iterators
+      static const int v_max = 255;
+      /// How often to repeat
+      static const int n_repeat = 32;
+      /// Range array type
+      typedef Gecode::Iter::Ranges::Array::Range Range;
+      /// Name of operation \a o
+      static std::string str(int o) {
+        switch (o) {
+        case 0: return "Unite";
+        case 1: return "Inter";
+        default: return "Diff";
+        }
+      }
+      /// Initialize \a a with random values up to \a v_max
+      static void random(Gecode::Region& r, bool* b,
+                         Gecode::Iter::Ranges::Array& a) {
+        // Create many short ranges to force reallocation of the buffer
+        Range* ri = r.alloc<Range>(v_max+1);
+        int m = 0;
+        for (int v=0; v<=v_max; v++) {
+          b[v] = (rand(3) == 0);
+          if (b[v]) {
+            if ((m > 0) && (ri[m-1].max+1 == v)) {
+              ri[m-1].max = v;
+            } else {
+              ri[m].min = ri[m].max = v; m++;
+            }
+          }
+        }
+        a.init(ri,m);
+      }
+      /// Test whether \a i has maximal and sorted ranges for values \a u
+      template<class I>
+      static bool check(I& i, const bool* u) {
+        int v = 0;
+        for (; i(); ++i) {
+          for (; v < i.min(); v++)
+            if (u[v])
+              return false;
+          if ((v > 0) && (v == i.min()) && u[v-1])
+            return false;
+          for (; v <= i.max(); v++)
+            if ((v > v_max) || !u[v])
+              return false;
+        }
+        for (; v <= v_max; v++)
+          if (u[v])
+            return false;
+        return true;
+      }
+    public:
+      /// Initialize test
+      Buffer(int o0)
+        : Test::Base("Iter::Ranges::Buffer::"+str(o0)), o(o0) {}
+      /// Perform actual tests
+      bool run(void) {
+        using namespace Gecode;
+        Region r;
+        // The same buffer is refilled for every repetition
+        Gecode::Iter::Ranges::Buffer b(r);
+        for (int k=n_repeat; k--; ) {
+          bool bi[v_max+1], bj[v_max+1], u[v_max+1];
+          Gecode::Iter::Ranges::Array i, j;
+          random(r,bi,i);
+          random(r,bj,j);
+          for (int v=0; v<=v_max; v++)
+            switch (o) {
+            case 0: u[v] = bi[v] || bj[v]; break;
+            case 1: u[v] = bi[v] && bj[v]; break;
+            default: u[v] = bi[v] && !bj[v]; break;
+            }
+          switch (o) {
+          case 0: b.unite(i,j); break;
+          case 1: b.inter(i,j); break;
+          default: b.diff(i,j); break;
+          }
+          if (!check(b,u))
+            return false;
+          // The buffer can be iterated again after reset
+          b.reset();
+          if (!check(b,u))
+            return false;
+        }
+        return true;
+      }
+    };
+
+    Buffer bu(0);
+    Buffer bi(1);
+    Buffer bd(2);
+
+  }
+
+}
+
+// STATISTICS: test-core
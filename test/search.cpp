@@ -308,6 +308,140 @@ namespace Test {
       }
     };
 
+    /// Space with a deep search tree
+    class Deep : public TestSpace {
+    public:
+      /// Variables used
+      BoolVarArray x;
+      /// Constructor for space creation
+      Deep(HowToBranch, HowToBranch, HowToBranch,
+           HowToConstrain=HTC_NONE)
+        : x(*this,16,0,1) {
+        linear(*this, x, IRT_EQ, 2);
+        Gecode::branch(*this, x, BOOL_VAR_NONE(), BOOL_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      Deep(Deep& s) : TestSpace(s) {
+        x.update(*this, s.x);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new Deep(*this);
+      }
+      /// Add constraint for next better solution
+      virtual void constrain(const Space&) {
+      }
+      /// Return number of solutions
+      virtual int solutions(void) const {
+        return 120;
+      }
+      /// Verify that this is best solution
+      virtual bool best(void) const {
+        return true;
+      }
+      /// Return name
+      static std::string name(void) {
+        return "Deep";
+      }
+    };
+
+    /// Space with a cost to be minimized
+    class HasCost : public TestSpace {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Cost
+      IntVar c;
+      /// Constructor for space creation
+      HasCost(HowToBranch htb, HowToBranch, HowToBranch,
+              HowToConstrain=HTC_NONE)
+        : x(*this,6,0,5), c(*this,-100,100) {
+        distinct(*this, x);
+        IntArgs a({3,-2,1,-1,2,-3});
+        linear(*this, a, x, IRT_EQ, c);
+        if (htb == HTB_NARY)
+          Gecode::branch(*this, x, INT_VAR_NONE(), INT_VALUES_MIN());
+        else
+          Gecode::branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      HasCost(HasCost& s) : TestSpace(s) {
+        x.update(*this, s.x);
+        c.update(*this, s.c);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new HasCost(*this);
+      }
+      /// Return cost
+      IntVar cost(void) const {
+        return c;
+      }
+      /// Add constraint for next better solution
+      virtual void constrain(const Space& _s) {
+        const HasCost& s = static_cast<const HasCost&>(_s);
+        rel(*this, c, IRT_LE, s.c.val());
+      }
+      /// Return number of solutions
+      virtual int solutions(void) const {
+        return 1;
+      }
+      /// Verify that this is best solution
+      virtual bool best(void) const {
+        return c.val() == -22;
+      }
+      /// Return name
+      static std::string name(void) {
+        return "Cost";
+      }
+    };
+
+    /// Space with a cost whose first solution found is optimal
+    class FirstBest : public TestSpace {
+    public:
+      /// Variables used
+      IntVarArray x;
+      /// Cost
+      IntVar c;
+      /// Constructor for space creation
+      FirstBest(HowToBranch, HowToBranch, HowToBranch,
+                HowToConstrain=HTC_NONE)
+        : x(*this,6,0,3), c(*this,0,18) {
+        linear(*this, x, IRT_EQ, c);
+        Gecode::branch(*this, x, INT_VAR_NONE(), INT_VAL_MIN());
+      }
+      /// Constructor for cloning \a s
+      FirstBest(FirstBest& s) : TestSpace(s) {
+        x.update(*this, s.x);
+        c.update(*this, s.c);
+      }
+      /// Copy during cloning
+      virtual Space* copy(void) {
+        return new FirstBest(*this);
+      }
+      /// Return cost
+      IntVar cost(void) const {
+        return c;
+      }
+      /// Add constraint for next better solution
+      virtual void constrain(const Space& _s) {
+        const FirstBest& s = static_cast<const FirstBest&>(_s);
+        rel(*this, c, IRT_LE, s.c.val());
+      }
+      /// Return number of solutions
+      virtual int solutions(void) const {
+        return 1;
+      }
+      /// Verify that this is best solution
+      virtual bool best(void) const {
+        return c.val() == 0;
+      }
+      /// Return name
+      static std::string name(void) {
+        return "FirstBest";
+      }
+    };
+
     /// %Base class for search tests
     class Test : public Base {
     public:
@@ -397,6 +531,215 @@ namespace Test {
       }
     };
 
+    /// %Test for depth-first search with solution visitor
+    template<class Model>
+    class Visit : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+    public:
+      /// Initialize test
+      Visit(HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+            unsigned int t0)
+        : Test("Visit::"+Model::name()+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::CountVisitor v;
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.visitor = &v;
+        Gecode::DFS<Model> dfs(m,o);
+        unsigned long int n = static_cast<unsigned long int>(m->solutions());
+        delete m;
+        Model* s = dfs.next();
+        if (s != NULL) {
+          delete s; return false;
+        }
+        return v.solutions() == n;
+      }
+    };
+
+    /// %Test for branch-and-bound search with solution visitor
+    template<class Model>
+    class VisitBAB : public Test {
+    private:
+      /// Number of threads
+      unsigned int t;
+      /// %Visitor that checks that solutions improve
+      class Better : public Gecode::Search::Visitor {
+      public:
+        /// Last visited solution
+        Model* l;
+        /// Whether every solution was better than the previous one
+        bool ok;
+        /// Initialize
+        Better(void) : l(NULL), ok(true) {}
+        /// Check that solution \a s is better than the last one
+        virtual void solution(const Gecode::Space& s) {
+          Model* c = static_cast<Model*>(s.clone());
+          if (l != NULL) {
+            Model* b = static_cast<Model*>(l->clone());
+            b->constrain(*c);
+            ok = ok && (b->status() == Gecode::SS_FAILED);
+            delete b;
+          }
+          delete l; l = c;
+        }
+        /// Delete last solution
+        virtual ~Better(void) {
+          delete l;
+        }
+      };
+    public:
+      /// Initialize test
+      VisitBAB(HowToConstrain htc,
+               HowToBranch htb1, HowToBranch htb2, HowToBranch htb3,
+               unsigned int t0)
+        : Test("Visit::BAB::"+Model::name()+"::"+str(htc)+"::"+
+               str(htb1)+"::"+str(htb2)+"::"+str(htb3)+"::"+str(t0),
+               htb1,htb2,htb3,htc), t(t0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3,htc);
+        Better v;
+        Gecode::Search::Options o;
+        o.threads = t;
+        o.visitor = &v;
+        Gecode::BAB<Model> bab(m,o);
+        delete m;
+        Model* s = bab.next();
+        if (s != NULL) {
+          delete s; return false;
+        }
+        return v.ok && ((v.l == NULL) || v.l->best());
+      }
+    };
+
+    /// %Test that engines without visitor support reject a visitor
+    class NoVisit : public Base {
+    public:
+      /// Initialize test
+      NoVisit(void) : Base("Search::Visit::Unsupported") {}
+      /// Run test
+      virtual bool run(void) {
+        Gecode::Search::CountVisitor v;
+        Gecode::Search::Options o;
+        o.visitor = &v;
+        o.cutoff = Gecode::Search::Cutoff::constant(1);
+        HasSolutions* m = new HasSolutions(HTB_BINARY,HTB_NONE,HTB_NONE);
+        bool ok = true;
+        try {
+          Gecode::LDS<HasSolutions> lds(m,o);
+          ok = false;
+        } catch (Gecode::Search::NoVisitor&) {}
+        try {
+          Gecode::RBS<HasSolutions,Gecode::DFS> rbs(m,o);
+          ok = false;
+        } catch (Gecode::Search::NoVisitor&) {}
+        delete m;
+        delete o.cutoff;
+        return ok;
+      }
+    };
+
+    /// %Test for search with a memory budget
+    template<class Model, template<class> class Engine>
+    class Memory : public Test {
+    private:
+      /// Number of clones that fit into the budget
+      unsigned int c;
+    public:
+      /// Initialize test
+      Memory(const std::string& e, unsigned int c0)
+        : Test("Memory::"+e+"::"+Model::name()+"::"+str(c0),
+               HTB_BINARY,HTB_BINARY,HTB_BINARY), c(c0) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        (void) m->status();
+        size_t l;
+        {
+          Space* s = m->clone();
+          l = c * s->allocated();
+          delete s;
+        }
+        Gecode::Search::Options o;
+        o.c_d = 1;
+        o.mem_limit = l;
+        Engine<Model> e(m,o);
+        int n = m->solutions();
+        delete m;
+        while (Model* s = e.next()) {
+          n--; delete s;
+        }
+        return (n == 0) && (e.statistics().memory <= l);
+      }
+    };
+
+    /// %Test for best-first search
+    template<class Model>
+    class BFS : public Test {
+    public:
+      /// Initialize test
+      BFS(HowToBranch htb1)
+        : Test("BFS::"+Model::name()+"::"+str(htb1),
+               htb1,HTB_NONE,HTB_NONE) {}
+      /// Run test
+      virtual bool run(void) {
+        Model* m = new Model(htb1,htb2,htb3);
+        Gecode::Search::FailStop f(2);
+        Gecode::Search::Options o;
+        o.stop = &f;
+        Gecode::BFS<Model> bfs(m,o);
+        delete m;
+        Model* b = NULL;
+        while (true) {
+          Model* s = bfs.next();
+          if (s != NULL) {
+            if ((b != NULL) && (s->c.val() >= b->c.val())) {
+              delete b; delete s; return false;
+            }
+            delete b; b = s;
+          }
+          if ((s == NULL) && !bfs.stopped())
+            break;
+          f.limit(f.limit()+2);
+        }
+        bool ok = (b != NULL) && b->best();
+        delete b;
+        return ok;
+      }
+    };
+
+    /// %Test that best-first search discards nodes that cannot improve
+    class BFSPrune : public Test {
+    public:
+      /// Initialize test
+      BFSPrune(void)
+        : Test("BFS::Prune::"+FirstBest::name(),
+               HTB_BINARY,HTB_NONE,HTB_NONE) {}
+      /// Run test
+      virtual bool run(void) {
+        FirstBest* m = new FirstBest(htb1,htb2,htb3);
+        Gecode::BFS<FirstBest> bfs(m);
+        int n = m->x.size();
+        delete m;
+        FirstBest* s = bfs.next();
+        bool ok = (s != NULL) && s->best() && (bfs.next() == NULL);
+        delete s;
+        /*
+         * The engine dives to the optimal solution with n branching
+         * nodes. All open nodes have the same bound as the solution
+         * and must be discarded instead of being explored.
+         */
+        return ok && (bfs.statistics().node ==
+                      static_cast<unsigned long int>(n+1));
+      }
+    };
+
     /// %Test for limited discrepancy search
     template<class Model>
     class LDS : public Test {
@@ -723,6 +1066,40 @@ namespace Test {
                                     c_d, a_d, t);
             }
 
+        // Depth-first search with solution visitor
+        for (unsigned int t = 1; t<=4; t++) {
+          for (BranchTypes htb1; htb1(); ++htb1)
+            for (BranchTypes htb2; htb2(); ++htb2)
+              for (BranchTypes htb3; htb3(); ++htb3)
+                (void) new Visit<HasSolutions>(htb1.htb(),htb2.htb(),
+                                               htb3.htb(),t);
+          (void) new Visit<FailImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, t);
+          (void) new Visit<SolveImmediate>(HTB_NONE, HTB_NONE, HTB_NONE, t);
+          for (ConstrainTypes htc; htc(); ++htc)
+            for (BranchTypes htb1; htb1(); ++htb1)
+              for (BranchTypes htb2; htb2(); ++htb2)
+                for (BranchTypes htb3; htb3(); ++htb3)
+                  (void) new VisitBAB<HasSolutions>(htc.htc(),htb1.htb(),
+                                                    htb2.htb(),htb3.htb(),t);
+          (void) new VisitBAB<FailImmediate>(HTC_NONE, HTB_NONE, HTB_NONE,
+                                             HTB_NONE, t);
+          (void) new VisitBAB<SolveImmediate>(HTC_NONE, HTB_NONE, HTB_NONE,
+                                              HTB_NONE, t);
+        }
+        (void) new NoVisit;
+
+        // Search with memory budget
+        for (unsigned int c = 1; c<=4; c++) {
+          (void) new Memory<Deep,Gecode::DFS>("DFS",c);
+          (void) new Memory<Deep,Gecode::BAB>("BAB",c);
+          (void) new Memory<HasSolutions,Gecode::DFS>("DFS",c);
+        }
+
+        // Best-first search
+        (void) new BFS<HasCost>(HTB_BINARY);
+        (void) new BFS<HasCost>(HTB_NARY);
+        (void) new BFSPrune;
+
         // Limited discrepancy search
         for (unsigned int t = 1; t<=4; t++) {
           for (BranchTypes htb1; htb1(); ++htb1)